@@ -0,0 +1,54 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+O="--quiet --options=NONE --pseudo-tags=-TAG_PROC_CWD --pseudo-tags=-TAG_PROGRAM_VERSION"
+D=$BUILDDIR/cache-option
+rm -rf $D
+mkdir -p $D/src
+
+printf 'int keep (void) { return 0; }\n' > $D/src/keep.c
+printf 'int changed (void) { return 0; }\n' > $D/src/changed.c
+printf 'def removed():\n    pass\n' > $D/src/removed.py
+printf 'no parser\n' > $D/src/unknown.txt
+# Files modified just before running ctags are never taken from the cache.
+touch -t 202001010000 $D/src/*
+
+cd $D
+
+echo "# first run"
+${CTAGS} $O --cache -R -o tags src
+ls tags.cache
+
+echo "# nothing changed"
+${CTAGS} $O --cache --verbose -R -o tags src 2>&1 | grep '^using cached' | sort
+${CTAGS} $O -R -o full src
+diff -u full tags
+
+echo "# a file changed, a file removed, and a file added"
+printf 'int renamed (void) { return 1; }\nint added;\n' > src/changed.c
+rm src/removed.py
+printf 'int fresh (void) { return 2; }\n' > src/fresh.c
+touch -t 202001010000 src/changed.c src/fresh.c
+${CTAGS} $O --cache --verbose -R -o tags src 2>&1 | grep '^using cached' | sort
+${CTAGS} $O -R -o full src
+diff -u full tags
+
+echo "# with jobs"
+${CTAGS} $O --cache --jobs=2 -R -o tags src 2>/dev/null
+diff -u full tags
+
+echo "# with other options"
+${CTAGS} $O --cache --verbose --fields=+n -R -o tags src 2>&1 | grep '^using cached' | sort
+${CTAGS} $O --fields=+n -R -o full src
+diff -u full tags
+
+echo "# incompatible options"
+${CTAGS} $O --cache --append -o tags src/keep.c 2>&1
+${CTAGS} $O --cache -o - src/keep.c 2>&1
+${CTAGS} $O --cache --output-format=etags -o TAGS src/keep.c 2>&1
+exit 0
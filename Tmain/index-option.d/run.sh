@@ -0,0 +1,63 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+. ../utils.sh
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE --pseudo-tags=-TAG_PROC_CWD --pseudo-tags=-TAG_PROGRAM_VERSION --fields=-T"
+D=$BUILDDIR/index-option
+rm -rf $D
+mkdir -p $D/src
+
+printf 'int alpha (void) { return 0; }\nint beta;\n' > $D/src/a.c
+printf 'int beta (void) { return 1; }\nstruct gamma { int alpha; };\n' > $D/src/b.c
+printf 'def Alpha():\n    pass\n' > $D/src/c.py
+
+cd $D
+
+echo "# lookups with the index"
+${CTAGS} $O --index -R -o tags src
+ls tags.idx
+${READTAGS} -t tags - alpha beta gamma Alpha delta
+
+echo "# lookups without the index"
+${CTAGS} $O -R -o plain src
+${READTAGS} -t plain - alpha beta gamma Alpha delta
+
+echo "# the index is used"
+# Claim the unsorted tag file is sorted, keeping its size and mtime.
+# Only lookups with the index can find the tags then.
+${CTAGS} $O --index --sort=no -R -o unsorted src
+cp -p unsorted unsorted.ref
+sed -e 's/^\(!_TAG_FILE_SORTED.\)0/\11/' unsorted.ref > unsorted
+touch -r unsorted.ref unsorted
+${READTAGS} -t unsorted - alpha beta gamma Alpha delta
+
+echo "# an out of date index is ignored"
+cp unsorted.idx plain.idx
+${READTAGS} -t plain - alpha beta gamma Alpha delta
+
+echo "# a stale index of a tag file keeping its size and mtime"
+# A tag missing in the index must still be found in the tag file.
+cp -p tags.idx stale.idx
+sed -e 's/^alpha\(.\)src/alphb\1src/' tags > stale
+touch -r tags stale
+${READTAGS} -t stale - alpha alphb beta
+
+echo "# names with escape sequences"
+printf 'def back\\slash\ndef tab\there\n' > d.x
+X="--langdef=X --map-X=.x --kinddef-X=d,def,defs --regex-X=/^def[[:space:]](.*)\$/\\1/d/"
+${CTAGS} $O $X --index -o escaped d.x
+${READTAGS} -t escaped - 'back\slash' "$(printf 'tab\there')"
+
+echo "# incompatible options"
+${CTAGS} $O --index -o - src/a.c 2>&1
+${CTAGS} $O --index --output-format=etags -o TAGS src/a.c 2>&1
+exit 0
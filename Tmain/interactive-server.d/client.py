@@ -0,0 +1,68 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+#
+# Send requests to the server without waiting for the responses, and
+# print the responses.
+
+import socket
+import sys
+import time
+
+path = sys.argv[1]
+
+def connect():
+    for i in range(100):
+        try:
+            s = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            s.connect(path)
+            return s
+        except OSError:
+            s.close()
+            time.sleep(0.1)
+    sys.exit("cannot connect to " + path)
+
+def session(title, requests, count):
+    print(title)
+    print("=======================================")
+    s = connect()
+    s.sendall(requests)
+    f = s.makefile("rb")
+    # The greeting, and a line for each tag or error until "completed"
+    line = f.readline()
+    sys.stdout.write(line.decode())
+    while count > 0:
+        line = f.readline()
+        if not line:
+            break
+        sys.stdout.write(line.decode())
+        if b'"completed"' in line:
+            count -= 1
+    f.close()
+    s.close()
+    print()
+    sys.stdout.flush()
+
+with open("test.rb", "rb") as f:
+    data = f.read()
+
+session("pipelined requests",
+        b'{"command":"generate-tags", "filename":"test.rb"}\n'
+        + b'{"command":"generate-tags", "filename":"foobar.rb", "size":'
+        + str(len(data)).encode() + b'}\n' + data
+        + b'{"command":"foobar"}\n'
+        + b'{"command":"generate-tags", "filename":"test.c"}\n',
+        3)
+
+session("batch request",
+        b'{"command":"generate-tags", "filenames":["test.c", "nosuchfile.c", "test.rb"]}\n',
+        1)
+
+# The requests are not converted with --input-encoding.
+session("request in UTF-8",
+        b'{"command":"generate-tags", "filename":"caf\xc3\xa9.rb", "size":'
+        + str(len(data)).encode() + b'}\n' + data,
+        1)
+
+session("shutdown",
+        b'{"command":"shutdown"}\n',
+        1)
@@ -0,0 +1,47 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+. ../utils.sh
+
+is_feature_available ${CTAGS} interactive
+is_feature_available ${CTAGS} json
+
+if ! ${CTAGS} --quiet --options=NONE --help-full | grep -q -e '--_interactive=server'; then
+	skip "server submode is not available"
+fi
+
+if ! type python3 > /dev/null 2>&1; then
+	skip "python3 is not available"
+fi
+
+# It seems that the output format is slightly different between libjansson versions
+s()
+{
+	sed -e s/':"'/': "'/g | jdropver
+}
+
+S=/tmp/ctags-tmain-$$.sock
+rm -f $S
+
+${CTAGS} --quiet --options=NONE --input-encoding=ISO-8859-1 --_interactive=server:$S &
+pid=$!
+
+python3 ./client.py $S | s
+
+wait $pid
+echo exit status: $?
+if [ -e $S ]; then
+	echo "$S is not removed"
+	rm -f $S
+fi
+
+echo
+echo the last --_interactive option wins
+echo =======================================
+echo '{"command":"generate-tags", "filename":"test.c"}' \
+	| ${CTAGS} --quiet --options=NONE --_interactive=server:$S --_interactive=default | s
+if [ -e $S ]; then
+	echo "$S is created"
+	rm -f $S
+fi
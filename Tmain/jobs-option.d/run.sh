@@ -0,0 +1,28 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+is_feature_available ${CTAGS} jobs
+
+O="--quiet --options=NONE --pseudo-tags=-TAG_PROC_CWD --pseudo-tags=-TAG_PROGRAM_VERSION"
+
+${CTAGS} $O -R -o $BUILDDIR/serial.tags ./src
+for j in 1 2 3 8; do
+	echo "# jobs=$j"
+	${CTAGS} $O --jobs=$j -R -o $BUILDDIR/jobs.tags ./src
+	diff -u $BUILDDIR/serial.tags $BUILDDIR/jobs.tags
+done
+
+echo "# jobs=3, unsorted, to stdout"
+${CTAGS} $O --extras=-p --jobs=3 --sort=no -R -o - ./src | sort
+
+echo "# pseudo tags written by more than one job"
+${CTAGS} $O --extras=+p --jobs=3 --sort=no -R -o - ./src | grep -c '^!_TAG_KIND_DESCRIPTION!C	f,function'
+
+echo "# jobs=0"
+${CTAGS} $O --jobs=0 -R -o - ./src 2>&1
+exit 0
@@ -0,0 +1,2 @@
+struct point { int x, y; };
+int a (void) { return 0; }
@@ -0,0 +1,2 @@
+#define C 1
+static int c (int v) { return v + C; }
@@ -0,0 +1 @@
+enum color { RED, GREEN };
@@ -0,0 +1,40 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+
+echo '# a name, a suffix, a wildcard pattern, and an extension'
+${CTAGS} --quiet --options=NONE \
+	 --map-Ruby=+'(Rakefile.local)' --map-Ruby=+'(*.rake2)' \
+	 --map-Ruby=+'(t?st.txt)' --map-Ruby=+.rbx \
+	 --print-language Rakefile.local x.rake2 test.txt a.rbx
+echo
+
+echo '# removing the mappings again'
+${CTAGS} --quiet --options=NONE \
+	 --map-Ruby=+'(Rakefile.local)' --map-Ruby=+'(*.rake2)' \
+	 --map-Ruby=+'(t?st.txt)' --map-Ruby=+.rbx \
+	 --map-Ruby=-'(Rakefile.local)' --map-Ruby=-'(*.rake2)' \
+	 --map-Ruby=-'(t?st.txt)' --map-Ruby=-.rbx \
+	 --print-language Rakefile.local x.rake2 test.txt a.rbx
+echo
+
+echo '# a pattern wins over an extension of a parser listed earlier'
+${CTAGS} --quiet --options=NONE \
+	 --map-Ada=+.rbx --map-Ruby=+'(*.rbx)' \
+	 --print-language a.rbx
+echo
+
+echo '# --langmap replacing the map'
+${CTAGS} --quiet --options=NONE \
+	 --map-Ruby=+.rbx --langmap=Ruby:.rake2 \
+	 --print-language x.rake2 a.rbx
+echo
+
+echo '# the patterns of two parsers matching the same name'
+${CTAGS} --quiet --options=NONE \
+	 --map-Ada=+'(*.rake2)' --map-Ruby=+'(*.rake2)' \
+	 --print-language x.rake2
+${CTAGS} --quiet --options=NONE \
+	 --map-Ruby=+'(*.rake2)' --map-Ada=+'(x.rake2)' \
+	 --print-language x.rake2
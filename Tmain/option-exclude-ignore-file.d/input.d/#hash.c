@@ -0,0 +1 @@
+int hash_func (void) { return 0; }
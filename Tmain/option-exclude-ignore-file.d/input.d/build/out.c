@@ -0,0 +1 @@
+int out_func (void) { return 0; }
@@ -0,0 +1 @@
+int doc_func (void) { return 0; }
@@ -0,0 +1 @@
+int generated_func (void) { return 0; }
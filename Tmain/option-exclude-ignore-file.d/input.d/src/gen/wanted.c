@@ -0,0 +1 @@
+int wanted_func (void) { return 0; }
@@ -0,0 +1 @@
+int main_func (void) { return 0; }
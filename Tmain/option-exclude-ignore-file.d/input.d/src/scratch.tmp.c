@@ -0,0 +1 @@
+int scratch_func (void) { return 0; }
@@ -0,0 +1,29 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS="$1"
+
+echo '# --exclude-ignore-file'
+${CTAGS} --quiet --options=NONE -o - -R --sort=yes \
+		 --exclude-ignore-file=ignore.txt \
+		 input.d
+
+echo '# --exclude-ignore-file with an empty argument'
+${CTAGS} --quiet --options=NONE -o - -R --sort=yes \
+		 --exclude-ignore-file=ignore.txt \
+		 --exclude-ignore-file= \
+		 input.d
+
+echo '# --exclude with --exclude-exception'
+${CTAGS} --quiet --options=NONE -o - -R --sort=yes \
+		 --exclude='input.d/build/*' \
+		 --exclude='input.d/vendor/*' \
+		 --exclude-exception='input.d/vendor/keep/*' \
+		 input.d
+
+echo '# directories pruned with --exclude and --exclude-exception'
+${CTAGS} --quiet --options=NONE -o /dev/null -R --verbose \
+		 --exclude='input.d/build/*' \
+		 --exclude='input.d/vendor/*' \
+		 --exclude-exception='input.d/vendor/keep/*' \
+		 input.d 2>&1 | grep -e '^excluding' | LC_ALL=C sort
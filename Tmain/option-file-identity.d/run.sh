@@ -0,0 +1,11 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS="$1"
+
+# An option file reached through different names is read only once.
+${CTAGS} --quiet --options=NONE \
+		 --options=opts.d/foo.ctags \
+		 --options=./opts.d/../opts.d/foo.ctags \
+		 --options=opts.d \
+		 -o - input.foo
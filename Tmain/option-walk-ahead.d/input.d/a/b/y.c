@@ -0,0 +1 @@
+int y_func (void) { return 0; }
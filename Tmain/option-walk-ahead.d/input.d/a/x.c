@@ -0,0 +1 @@
+int x_func (void) { return 0; }
@@ -0,0 +1 @@
+int z_func (void) { return 0; }
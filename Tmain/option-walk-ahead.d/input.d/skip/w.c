@@ -0,0 +1 @@
+int w_func (void) { return 0; }
@@ -0,0 +1 @@
+int top_func (void) { return 0; }
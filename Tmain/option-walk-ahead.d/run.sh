@@ -0,0 +1,22 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS="$1"
+
+. ../utils.sh
+
+is_feature_available ${CTAGS} jobs
+
+${CTAGS} --quiet --options=NONE -o - -R --sort=no \
+		 --exclude=skip \
+		 input.d > ./without.tmp
+
+${CTAGS} --quiet --options=NONE -o - -R --sort=no --walk-ahead \
+		 --exclude=skip \
+		 input.d > ./with.tmp
+
+LC_ALL=C sort ./with.tmp
+if cmp ./without.tmp ./with.tmp; then
+	echo "same order"
+fi
+rm -f ./without.tmp ./with.tmp
@@ -0,0 +1,3 @@
+int Foo;
+int foo;
+int bar;
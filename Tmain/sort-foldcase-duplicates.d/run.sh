@@ -0,0 +1,15 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE --sort=foldcase --pseudo-tags="
+
+echo '# stdout'
+${CTAGS} $O -o - input.c
+
+echo '# file'
+${CTAGS} $O -o $BUILDDIR/foldcase.tags input.c
+cat $BUILDDIR/foldcase.tags
+rm -f $BUILDDIR/foldcase.tags
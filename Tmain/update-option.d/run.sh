@@ -0,0 +1,55 @@
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+O="--quiet --options=NONE --pseudo-tags=-TAG_PROC_CWD --pseudo-tags=-TAG_PROGRAM_VERSION"
+D=$BUILDDIR/update-option
+rm -rf $D
+mkdir -p $D
+cp src/keep.c $D/
+printf 'int changed (void) { return 0; }\n' > $D/changed.c
+printf 'int removed (void) { return 0; }\n' > $D/removed.c
+
+cd $D
+${CTAGS} $O -o tags keep.c changed.c removed.c
+
+printf 'int renamed (void) { return 1; }\nint added;\n' > changed.c
+rm removed.c
+printf 'int fresh (void) { return 2; }\n' > fresh.c
+
+echo "# update"
+${CTAGS} $O --update -o tags changed.c removed.c fresh.c 2>/dev/null
+grep -v "^!_TAG_" tags
+
+echo "# same as a full run"
+${CTAGS} $O -o full keep.c changed.c fresh.c
+diff -u full tags
+
+echo "# update with jobs"
+printf 'int again (void) { return 3; }\n' > changed.c
+${CTAGS} $O --update --jobs=2 -o tags changed.c fresh.c 2>/dev/null
+${CTAGS} $O -o full keep.c changed.c fresh.c
+diff -u full tags
+
+echo "# update walking ahead"
+mkdir dir
+printf 'int kept (void) { return 4; }\n' > dir/kept.c
+printf 'int linked (void) { return 5; }\n' > linked.c
+ln -s ../linked.c dir/link.c
+${CTAGS} $O -R -o dtags dir
+rm linked.c
+${CTAGS} $O --update -R --walk-ahead -o dtags dir 2>/dev/null
+grep -v "^!_TAG_" dtags
+
+echo "# incompatible options"
+${CTAGS} $O --update --append -o tags keep.c 2>&1
+${CTAGS} $O --update --sort=no -o tags keep.c 2>&1
+${CTAGS} $O --update -o - keep.c 2>&1
+${CTAGS} $O --update --sort=foldcase -o tags keep.c 2>&1
+${CTAGS} $O --sort=foldcase -o ftags keep.c
+${CTAGS} $O --update --sort=yes -o ftags keep.c 2>&1
+exit 0
@@ -0,0 +1 @@
+int keep (void) { return 0; }
@@ -0,0 +1,11 @@
+/* The first pass fails at the end of the file. The second pass
+ * resumes after the definition of g, and the anonymous structs are
+ * numbered as if the file were parsed once. */
+#define M(x) ((x) + 1)
+struct { int x; } a0; int a1; struct { int y; } a2;
+static int g(int n) { return M(n); }
+#ifdef X
+int f(int x) {
+#endif
+	struct { int z; } a3;
+	return 0;
@@ -0,0 +1,2 @@
+int renamed (void) { return 1; }
+int added;
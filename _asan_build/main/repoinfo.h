@@ -0,0 +1 @@
+#define CTAGS_REPOINFO "6664e1f"
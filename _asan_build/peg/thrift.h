@@ -0,0 +1,21 @@
+/* A packrat parser generated by PackCC 1.8.0 */
+
+#ifndef PCC_INCLUDED___PEG_THRIFT_H
+#define PCC_INCLUDED___PEG_THRIFT_H
+
+struct parserCtx;
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct pthrift_context_tag pthrift_context_t;
+
+pthrift_context_t *pthrift_create(struct parserCtx *auxil);
+int pthrift_parse(pthrift_context_t *ctx, int *ret);
+void pthrift_destroy(pthrift_context_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !PCC_INCLUDED___PEG_THRIFT_H */
@@ -0,0 +1 @@
+#define CTAGS_REPOINFO "c867214"
@@ -0,0 +1,75 @@
+/*
+ * Generated by ../misc/optlib2c from ../optlib/gdbinit.ctags, Don't edit this manually.
+ */
+#include "general.h"
+#include "parse.h"
+#include "routines.h"
+#include "field.h"
+#include "xtag.h"
+
+
+static void initializeGdbinitParser (const langType language CTAGS_ATTR_UNUSED)
+{
+}
+
+extern parserDefinition* GdbinitParser (void)
+{
+	static const char *const extensions [] = {
+		"gdb",
+		NULL
+	};
+
+	static const char *const aliases [] = {
+		NULL
+	};
+
+	static const char *const patterns [] = {
+		".gdbinit",
+		NULL
+	};
+
+	static kindDefinition GdbinitKindTable [] = {
+		{
+		  true, 'd', "definition", "definitions",
+		},
+		{
+		  false, 'D', "document", "documents",
+		},
+		{
+		  true, 't', "toplevelVariable", "toplevel variables",
+		},
+		{
+		  false, 'l', "localVariable", "local variables",
+		},
+	};
+	static tagRegexTable GdbinitTagRegexTable [] = {
+		{"^#.*", "",
+		"", "{exclusive}", NULL, false},
+		{"^define[[:space:]]+([^[:space:]]+)$", "\\1",
+		"d", NULL, NULL, false},
+		{"^document[[:space:]]+([^[:space:]]+)$", "\\1",
+		"D", NULL, NULL, false},
+		{"^set[[:space:]]+\\$([a-zA-Z0-9_]+)[[:space:]]*=", "\\1",
+		"t", NULL, NULL, false},
+		{"^[[:space:]]+set[[:space:]]+\\$([a-zA-Z0-9_]+)[[:space:]]*=", "\\1",
+		"l", NULL, NULL, false},
+	};
+
+
+	parserDefinition* const def = parserNew ("Gdbinit");
+
+	def->versionCurrent= 0;
+	def->versionAge    = 0;
+	def->enabled       = true;
+	def->extensions    = extensions;
+	def->patterns      = patterns;
+	def->aliases       = aliases;
+	def->method        = METHOD_NOT_CRAFTED|METHOD_REGEX;
+	def->kindTable     = GdbinitKindTable;
+	def->kindCount     = ARRAY_SIZE(GdbinitKindTable);
+	def->tagRegexTable = GdbinitTagRegexTable;
+	def->tagRegexCount = ARRAY_SIZE(GdbinitTagRegexTable);
+	def->initialize    = initializeGdbinitParser;
+
+	return def;
+}
@@ -0,0 +1,88 @@
+/*
+ * Generated by ../misc/optlib2c from ../optlib/mesonOptions.ctags, Don't edit this manually.
+ */
+#include "general.h"
+#include "parse.h"
+#include "routines.h"
+#include "field.h"
+#include "xtag.h"
+
+
+static void initializeMesonOptionsParser (const langType language CTAGS_ATTR_UNUSED)
+{
+}
+
+extern parserDefinition* MesonOptionsParser (void)
+{
+	static const char *const extensions [] = {
+		NULL
+	};
+
+	static const char *const aliases [] = {
+		NULL
+	};
+
+	static const char *const patterns [] = {
+		"meson_options.txt",
+		NULL
+	};
+
+	static kindDefinition MesonOptionsKindTable [] = {
+		{
+		  true, 's', "string", "strings",
+		},
+		{
+		  true, 'b', "boolean", "booleans",
+		},
+		{
+		  true, 'c', "combo", "combos",
+		},
+		{
+		  true, 'i', "integer", "integers",
+		},
+		{
+		  true, 'a', "array", "arrays",
+		},
+		{
+		  true, 'f', "feature", "features",
+		},
+	};
+	static tagRegexTable MesonOptionsTagRegexTable [] = {
+		{"^option[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*,[ \t\n]*type[ \t\n]*:[ \t\n]*'([a-z]+)'", "",
+		"", ""
+		"{{\n"
+		"    % \\1 points a tag name.\n"
+		"    \\1\n"
+		"    % \\2 may point a kind. This must be converted to a name from a string.\n"
+		"    \\2 cvn\n"
+		"    % Push the start position of the group 1.\n"
+		"    @1\n"
+		"    % To skip an unexpected kind name, _tag is wrapped with stopped.\n"
+		"    { _tag } stopped {\n"
+		"        % Unexpected kind. Clear the stack.\n"
+		"        pop pop pop\n"
+		"    } {\n"
+		"        _commit pop\n"
+		"    } ifelse\n"
+		"}}", NULL, true},
+	};
+
+
+	parserDefinition* const def = parserNew ("MesonOptions");
+
+	def->versionCurrent= 0;
+	def->versionAge    = 0;
+	def->enabled       = true;
+	def->extensions    = extensions;
+	def->patterns      = patterns;
+	def->aliases       = aliases;
+	def->method        = METHOD_NOT_CRAFTED|METHOD_REGEX;
+	def->useCork       = CORK_QUEUE;
+	def->kindTable     = MesonOptionsKindTable;
+	def->kindCount     = ARRAY_SIZE(MesonOptionsKindTable);
+	def->tagRegexTable = MesonOptionsTagRegexTable;
+	def->tagRegexCount = ARRAY_SIZE(MesonOptionsTagRegexTable);
+	def->initialize    = initializeMesonOptionsParser;
+
+	return def;
+}
@@ -0,0 +1 @@
+int again (void) { return 3; }
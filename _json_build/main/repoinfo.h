@@ -0,0 +1 @@
+#define CTAGS_REPOINFO "7ae9d9b"
@@ -0,0 +1 @@
+int fresh (void) { return 2; }
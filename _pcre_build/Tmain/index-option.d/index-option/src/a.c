@@ -0,0 +1,2 @@
+int alpha (void) { return 0; }
+int beta;
@@ -0,0 +1,2 @@
+int beta (void) { return 1; }
+struct gamma { int alpha; };
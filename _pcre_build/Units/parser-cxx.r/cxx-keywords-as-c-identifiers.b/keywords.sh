@@ -0,0 +1,42 @@
+keywords="
+NotKeyword
+alignas
+alignof
+bool
+catch
+char16_t
+char32_t
+class
+concept
+constexpr
+const_cast
+decltype
+delete
+dynamic_cast
+explicit
+export
+final
+friend
+mutable
+namespace
+new
+noexcept
+nullptr
+operator
+private
+protected
+public
+reinterpret_cast
+requires
+static_assert
+static_cast
+template
+this
+thread_local
+throw
+try
+typeid
+typename
+using
+virtual
+"
@@ -0,0 +1 @@
+#define CTAGS_REPOINFO "5e1fb9c"
@@ -68,9 +68,39 @@ typedef struct sDictFat
 	unsigned int attr;
 } DictFat;
 
+/* An executable array (a proc) is compiled to an instruction stream
+ * when it is called first. Each instruction remembers the element it
+ * was compiled from, so an element replaced with put or bind is compiled
+ * again when it is executed next. */
+typedef enum eInsnKind {
+	INSN_EVAL,					/* evaluate the element with vm_eval () */
+	INSN_PUSH,					/* push the element to the ostack */
+	INSN_OPERATOR,				/* call the element, an operator */
+	INSN_BOUND,					/* call the operator bound to the element, a name */
+} InsnKind;
+
+typedef struct sInsn
+{
+	InsnKind kind;
+	EsObject *src;
+	/* For INSN_BOUND, the operator found in the dstack, and the value
+	 * of BindingEpoch when it was found. */
+	EsObject *op;
+	unsigned long epoch;
+} Insn;
+
+typedef struct sCode
+{
+	OptVM *vm;
+	unsigned int active;
+	unsigned int count;
+	Insn insns[];
+} Code;
+
 typedef struct sArrayFat
 {
 	unsigned int attr;
+	Code *code;
 } ArrayFat;
 
 typedef struct sStringFat
@@ -85,6 +115,12 @@ typedef struct sNameFat
 
 static EsObject* opt_system_dict;
 
+/* Incremented whenever a name bound to an operator in a compiled proc may
+ * be resolved differently: when the dstack changes, or when a dictionary
+ * gets or loses a key that is in BoundNames. */
+static unsigned long BindingEpoch = 1;
+static hashTable *BoundNames;
+
 int OPT_TYPE_ARRAY;
 int OPT_TYPE_DICT;
 int OPT_TYPE_OPERATOR;
@@ -168,6 +204,8 @@ static unsigned int array_op_length (const EsObject* array);
 static EsObject*    array_op_get    (const EsObject* array, unsigned int n);
 static void         array_op_put    (EsObject* array, unsigned int n, EsObject *obj);
 
+static void         code_delete     (Code *code);
+
 
 static EsObject* dict_new (unsigned int size, unsigned int attr);
 
@@ -226,6 +264,9 @@ static int       mark_es_equal (const void *a, const void *b);
 static EsObject* vm_read          (OptVM *vm);
 static EsObject* vm_call_operator (OptVM *vm, EsObject *op);
 static EsObject* vm_call_proc     (OptVM *vm, EsObject *proc);
+static EsObject* vm_call_proc_uncompiled (OptVM *vm, EsObject *proc);
+static Code*     vm_code_for_proc (OptVM *vm, EsObject *proc, unsigned int count);
+static void      vm_compile_insn  (OptVM *vm, Insn *insn, EsObject *o);
 static void      vm_print         (OptVM *vm, EsObject *o);
 static void      vm_print_full    (OptVM *vm, EsObject *o, bool string_as_is, int dict_recursion);
 static void      vm_help          (OptVM *vm, MIO *out, struct OptHelpExtender *extop, void *data);
@@ -407,6 +448,9 @@ declop(_copyinterval);
 int
 opt_init (void)
 {
+	if (BoundNames == NULL)
+		BoundNames = hashTableNew (67, hashPtrhash, hashPtreq, NULL, NULL);
+
 	OPT_TYPE_ARRAY    = es_type_define_fatptr ("arraytype",
 											   sizeof (ArrayFat),
 											   array_es_init_fat,
@@ -670,6 +714,16 @@ opt_vm_delete (OptVM *vm)
 	eFree (vm);
 }
 
+void
+opt_fin (void)
+{
+	if (BoundNames)
+	{
+		hashTableDelete (BoundNames);
+		BoundNames = NULL;
+	}
+}
+
 EsObject *
 opt_dict_new (unsigned int size)
 {
@@ -1432,6 +1486,7 @@ vm_dict_def (OptVM *vm, EsObject *key, EsObject *val)
 static void
 vm_dstack_push  (OptVM *vm, EsObject *o)
 {
+	BindingEpoch++;
 	ptrArrayAdd (vm->dstack, es_object_ref (o));
 }
 
@@ -1446,6 +1501,7 @@ vm_dstack_pop (OptVM *vm)
 {
 	if (vm_dstack_count (vm) <= vm->dstack_protection)
 		return OPT_ERR_DICTSTACKUNDERFLOW;
+	BindingEpoch++;
 	ptrArrayDeleteLast (vm->dstack);
 	return es_false;
 }
@@ -1453,6 +1509,7 @@ vm_dstack_pop (OptVM *vm)
 static void
 vm_dstack_clear         (OptVM *vm)
 {
+	BindingEpoch++;
 	while (ptrArrayCount (vm->dstack) > 1)
 		ptrArrayDeleteLast (vm->dstack);
 
@@ -1497,6 +1554,57 @@ vm_call_operator (OptVM *vm, EsObject *op)
 
 static EsObject*
 vm_call_proc     (OptVM *vm, EsObject *proc)
+{
+	ptrArray *a = es_pointer_get (proc);
+	unsigned int c = ptrArrayCount (a);
+	Code *code = vm_code_for_proc (vm, proc, c);
+
+	if (code == NULL)
+		return vm_call_proc_uncompiled (vm, proc);
+
+	code->active++;
+	vm_estack_push (vm, proc);
+	for (unsigned int i = 0; i < c; i++)
+	{
+		EsObject *o = ptrArrayItem (a, i);
+		Insn *insn = code->insns + i;
+		EsObject* e;
+
+		if (insn->src != o
+			|| (insn->kind == INSN_BOUND && insn->epoch != BindingEpoch))
+			vm_compile_insn (vm, insn, o);
+
+		switch (insn->kind)
+		{
+		case INSN_PUSH:
+			vm_ostack_push (vm, o);
+			continue;
+		case INSN_OPERATOR:
+			e = vm_call_operator (vm, o);
+			break;
+		case INSN_BOUND:
+			e = vm_call_operator (vm, insn->op);
+			break;
+		default:
+			e = vm_eval (vm, o);
+			break;
+		}
+
+		if (es_error_p (e))
+		{
+			vm_estack_pop (vm);	/* ??? */
+			code->active--;
+			return e;
+		}
+	}
+	vm_estack_pop (vm);
+	code->active--;
+
+	return es_false;
+}
+
+static EsObject*
+vm_call_proc_uncompiled (OptVM *vm, EsObject *proc)
 {
 	ptrArray *a = es_pointer_get (proc);
 	unsigned int c = ptrArrayCount (a);
@@ -1517,6 +1625,96 @@ vm_call_proc     (OptVM *vm, EsObject *proc)
 	return es_false;
 }
 
+/* Return the code compiled from PROC, which has COUNT elements.
+ * NULL is returned if the code compiled before doesn't fit PROC anymore
+ * but cannot be replaced because PROC is being executed. */
+static Code*
+vm_code_for_proc (OptVM *vm, EsObject *proc, unsigned int count)
+{
+	ArrayFat *afat = es_fatptr_get (proc);
+	Code *code = afat->code;
+
+	if (code && code->vm == vm && code->count == count)
+		return code;
+
+	if (code)
+	{
+		if (code->active > 0)
+			return NULL;
+		code_delete (code);
+	}
+
+	code = eMalloc (sizeof (Code) + sizeof (Insn) * count);
+	code->vm = vm;
+	code->active = 0;
+	code->count = count;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		code->insns[i].kind = INSN_EVAL;
+		code->insns[i].src = NULL;
+		code->insns[i].op = NULL;
+		code->insns[i].epoch = 0;
+	}
+	afat->code = code;
+	return code;
+}
+
+static void
+vm_compile_insn (OptVM *vm, Insn *insn, EsObject *o)
+{
+	int t = es_object_get_type (o);
+
+	if (insn->src != o)
+	{
+		if (insn->src)
+			es_object_unref (insn->src);
+		insn->src = es_object_ref (o);
+	}
+	insn->op = NULL;
+
+	if (es_error_p (o))
+		insn->kind = INSN_EVAL;
+	else if (t == OPT_TYPE_OPERATOR)
+		insn->kind = INSN_OPERATOR;
+	else if (t != OPT_TYPE_NAME)
+		insn->kind = INSN_PUSH;
+	else if (!(((NameFat *)es_fatptr_get (o))->attr & ATTR_EXECUTABLE))
+		insn->kind = INSN_PUSH;
+	else
+	{
+		/* Bind the name only if it is resolved to an operator defined
+		 * with the same name. A name bound to an operator with other
+		 * name is not in BoundNames, and redefining it doesn't
+		 * increment BindingEpoch. */
+		EsObject *sym = es_pointer_get (o);
+		EsObject *val = es_nil;
+		EsObject *dict = vm_dstack_known_and_get (vm, sym, &val);
+
+		insn->kind = INSN_EVAL;
+		if (es_object_get_type (dict) == OPT_TYPE_DICT
+			&& es_object_get_type (val) == OPT_TYPE_OPERATOR
+			&& ((OperatorFat *)es_fatptr_get (val))->name == sym)
+		{
+			if (!hashTableHasItem (BoundNames, sym))
+				hashTablePutItem (BoundNames, sym, sym);
+			insn->kind = INSN_BOUND;
+			insn->op = val;
+			insn->epoch = BindingEpoch;
+		}
+	}
+}
+
+static void
+code_delete (Code *code)
+{
+	for (unsigned int i = 0; i < code->count; i++)
+	{
+		if (code->insns[i].src)
+			es_object_unref (code->insns[i].src);
+	}
+	eFree (code);
+}
+
 static EsObject*
 vm_estack_push (OptVM *vm, EsObject *p)
 {
@@ -1988,12 +2186,16 @@ array_es_init_fat (void *fat, void *ptr, void *extra)
 {
 	ArrayFat *a = fat;
 	a->attr = *((unsigned int *)extra);
+	a->code = NULL;
 	return es_false;
 }
 
 static void
 array_es_free (void *ptr, void *fat)
 {
+	ArrayFat *a = fat;
+	if (a->code)
+		code_delete (a->code);
 	if (ptr)
 		ptrArrayDelete ((ptrArray *)ptr);
 }
@@ -2133,6 +2335,9 @@ dict_op_def (EsObject* dict, EsObject *key, EsObject *val)
 	if (es_object_get_type (key) == OPT_TYPE_NAME)
 		key = es_pointer_get (key);
 
+	if (hashTableHasItem (BoundNames, key))
+		BindingEpoch++;
+
 	key = es_object_ref (key);
 	val = es_object_ref (val);
 
@@ -2152,6 +2357,9 @@ dict_op_undef (EsObject *dict, EsObject *key)
 	if (es_object_get_type (key) == OPT_TYPE_NAME)
 		key = es_pointer_get (key);
 
+	if (hashTableHasItem (BoundNames, key))
+		BindingEpoch++;
+
 	/* TODO: handle the case key == NULL */
 	return hashTableDeleteItem (t, key);
 }
@@ -2186,6 +2394,7 @@ dict_op_clear (EsObject* dict)
 	hashTable *h = es_pointer_get (dict);
 	Assert (h);
 
+	BindingEpoch++;
 	hashTableClear (h);
 }
 
@@ -2687,6 +2896,7 @@ op__copy_compound (OptVM *vm, EsObject *name, unsigned int c, EsObject *obj2)
 	{
 		hashTable *ht1 = es_pointer_get (obj1);
 		hashTable *ht2 = es_pointer_get (obj2);
+		BindingEpoch++;
 		hashTableClear (ht2);
 		hashTableForeachItem (ht1, dict_copy_cb, ht2);
 	}
@@ -3165,6 +3375,7 @@ static EsObject*
 op_cleardictstack (OptVM *vm, EsObject *name)
 {
 	unsigned int d = ptrArrayCount (vm->dstack) - vm->dstack_protection;
+	BindingEpoch++;
 	ptrArrayDeleteLastInBatch (vm->dstack, d);
 	return es_false;
 }
@@ -24,6 +24,7 @@ struct OptHelpExtender {
 };
 
 int       opt_init (void);
+void      opt_fin  (void);
 
 OptVM    *opt_vm_new          (MIO *in, MIO *out, MIO *err);
 void      opt_vm_delete       (OptVM *vm);
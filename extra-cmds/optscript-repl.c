@@ -220,6 +220,7 @@ main(int argc, char **argv)
 	es_object_unref (dict);
 
 	opt_vm_delete (vm);
+	opt_fin ();
 
 	mio_unref (err);
 	mio_unref (out);
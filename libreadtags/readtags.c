@@ -15,6 +15,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <sys/types.h>  /* to declare off_t */
+#include <sys/stat.h>
 
 #include "readtags.h"
 
@@ -23,6 +24,27 @@
 */
 #define TAB '\t'
 
+/* Initial size of the buffer through which lines of a tag file are read */
+#define CHUNK_SIZE 65536
+
+/* The companion index written by "ctags --index". See main/tagindex.c
+ * in Universal Ctags for the format. */
+#define TAG_INDEX_SUFFIX ".idx"
+#define TAG_INDEX_MAGIC "!_TAGIDX"
+#define TAG_INDEX_FORMAT 2
+#define TAG_INDEX_HEADER_SIZE 40
+#define TAG_INDEX_ENTRY_SIZE 12
+#define TAG_INDEX_MAX_BITS 24
+
+/* Nanoseconds of the last modified time in struct stat */
+#if defined(_WIN32)
+# define ST_MTIME_NSEC(st) 0
+#elif defined(__APPLE__)
+# define ST_MTIME_NSEC(st) ((st).st_mtimespec.tv_nsec)
+#else
+# define ST_MTIME_NSEC(st) ((st).st_mtim.tv_nsec)
+#endif
+
 
 /*
 *   DATA DECLARATIONS
@@ -53,6 +75,19 @@ struct sTagFile {
 	tagSortType sortMethod;
 		/* pointer to file structure */
 	FILE* fp;
+		/* part of the tag file read ahead through fp */
+	struct {
+				/* buffer holding the part */
+			char *addr;
+				/* allocated size of the buffer */
+			size_t size;
+				/* number of characters held in the buffer */
+			size_t length;
+				/* index of the next character to read in the buffer */
+			size_t offset;
+				/* file position of the first character in the buffer */
+			rt_off_t start;
+	} chunk;
 		/* file position of first character of `line' */
 	rt_off_t pos;
 		/* size of tag file in seekable positions */
@@ -95,6 +130,18 @@ struct sTagFile {
 		/* 0 (initial state set by calloc), errno value,
 		 * or tagErrno typed value */
 	int err;
+		/* companion index */
+	struct {
+				/* NULL if no usable index is found */
+			FILE *fp;
+				/* number of bits of the bucket table */
+			unsigned int bits;
+				/* size and last modified time of the tag file
+				 * when the index was made */
+			unsigned long long size;
+			unsigned long long mtime;
+			unsigned long mtimeNsec;
+	} index;
 };
 
 /*
@@ -134,6 +181,44 @@ static int readtags_fseek(FILE *fp, rt_off_t pos, int whence)
 	return ret;
 }
 
+/* Return the file position of the tag file. */
+static rt_off_t tellTagFile (tagFile *const file)
+{
+	return file->chunk.start + (rt_off_t) file->chunk.offset;
+}
+
+/* Set the file position of the tag file like fseek(). A position in the
+ * chunk is reached without a system call, which keeps the seeks of the
+ * binary search cheap once the range of candidates becomes small. */
+static int seekTagFile (tagFile *const file, rt_off_t pos, int whence)
+{
+	if (whence == SEEK_CUR)
+	{
+		pos += tellTagFile (file);
+		whence = SEEK_SET;
+	}
+	if (whence == SEEK_SET
+		&& pos >= file->chunk.start
+		&& pos <= file->chunk.start + (rt_off_t) file->chunk.length)
+	{
+		file->chunk.offset = (size_t) (pos - file->chunk.start);
+		return 0;
+	}
+
+	if (readtags_fseek (file->fp, pos, whence) < 0)
+		return -1;
+	if (whence == SEEK_END)
+	{
+		pos = readtags_ftell (file->fp);
+		if (pos < 0)
+			return -1;
+	}
+	file->chunk.start = pos;
+	file->chunk.length = 0;
+	file->chunk.offset = 0;
+	return 0;
+}
+
 /* Converts a hexadecimal digit to its value */
 static int xdigitValue (unsigned char digit)
 {
@@ -306,71 +391,112 @@ static tagResult copyName (tagFile *const file)
 	return TagSuccess;
 }
 
-/* Return 1 on success.
- * Return 0 on failure or EOF.
- * errno is set to *err unless EOF.
- */
-static int readTagLineRaw (tagFile *const file, int *err)
+/* Append the next part of the tag file to the unread characters of the
+ * chunk. The chunk grows only if a line doesn't fit in it.
+ * Return the number of characters appended; 0 at EOF.
+ * Return -1 on failure with setting *err. */
+static int fillChunk (tagFile *const file, int *err)
 {
-	int result = 1;
-	int reReadLine;
-
-	/*  If reading the line places any character other than a null or a
-	 *  newline at the last character position in the buffer (one less than
-	 *  the buffer size), then we must resize the buffer and reattempt to read
-	 *  the line.
-	 */
-	do
+	size_t n;
+
+	if (file->chunk.offset > 0)
 	{
-		char *const pLastChar = file->line.buffer + file->line.size - 2;
-		char *line;
+		file->chunk.length -= file->chunk.offset;
+		memmove (file->chunk.addr, file->chunk.addr + file->chunk.offset,
+				 file->chunk.length);
+		file->chunk.start += (rt_off_t) file->chunk.offset;
+		file->chunk.offset = 0;
+	}
 
-		file->pos = readtags_ftell (file->fp);
-		if (file->pos < 0)
+	if (file->chunk.length == file->chunk.size)
+	{
+		size_t newSize = file->chunk.size? file->chunk.size * 2: CHUNK_SIZE;
+		char *newAddr = (char *) realloc (file->chunk.addr, newSize);
+		if (newAddr == NULL)
 		{
-			*err = errno;
-			result = 0;
-			break;
+			*err = ENOMEM;
+			return -1;
 		}
-		reReadLine = 0;
-		*pLastChar = '\0';
-		line = fgets (file->line.buffer, (int) file->line.size, file->fp);
-		if (line == NULL)
+		file->chunk.addr = newAddr;
+		file->chunk.size = newSize;
+	}
+
+	n = fread (file->chunk.addr + file->chunk.length, 1,
+			   file->chunk.size - file->chunk.length, file->fp);
+	if (n == 0 && ferror (file->fp))
+	{
+		*err = errno;
+		return -1;
+	}
+	file->chunk.length += n;
+	return (int) (n > 0);
+}
+
+/* Read a line from the chunk, locating its end with memchr(). */
+static int readChunkLine (tagFile *const file, int *err)
+{
+	const char *start, *end;
+	size_t scanned = 0;
+	size_t length, next;
+
+	file->pos = tellTagFile (file);
+	while (1)
+	{
+		const size_t avail = file->chunk.length - file->chunk.offset;
+		int r;
+
+		start = file->chunk.addr + file->chunk.offset;
+		end = (avail > scanned)? memchr (start + scanned, '\n', avail - scanned): NULL;
+		if (end != NULL)
 		{
-			/* read error */
-			*err = 0;
-			if (! feof (file->fp))
-				*err = errno;
-			result = 0;
+			length = end - start;
+			next = file->chunk.offset + length + 1;
+			break;
 		}
-		else if (*pLastChar != '\0'  &&
-					*pLastChar != '\n'  &&  *pLastChar != '\r')
-		{
-			/*  buffer overflow */
-			if (growString (&file->line) != TagSuccess)
-			{
-				*err = ENOMEM;
-				result = 0;
-			}
+		scanned = avail;
 
-			if (readtags_fseek (file->fp, file->pos, SEEK_SET) < 0)
+		r = fillChunk (file, err);
+		if (r < 0)
+			return 0;
+		else if (r == 0)
+		{
+			/* the last line without newline */
+			if (avail == 0)
 			{
-				*err = errno;
-				result = 0;
+				*err = 0;
+				return 0;
 			}
-			reReadLine = 1;
+			start = file->chunk.addr + file->chunk.offset;
+			length = avail;
+			next = file->chunk.length;
+			break;
 		}
-		else
+	}
+
+	while (length > 0  &&  start [length - 1] == '\r')
+		--length;
+	while (length >= file->line.size)
+	{
+		if (growString (&file->line) != TagSuccess)
 		{
-			size_t i = strlen (file->line.buffer);
-			while (i > 0  &&
-				   (file->line.buffer [i - 1] == '\n' || file->line.buffer [i - 1] == '\r'))
-			{
-				file->line.buffer [i - 1] = '\0';
-				--i;
-			}
+			*err = ENOMEM;
+			return 0;
 		}
-	} while (reReadLine  &&  result);
+	}
+	memcpy (file->line.buffer, start, length);
+	file->line.buffer [length] = '\0';
+	file->chunk.offset = next;
+	return 1;
+}
+
+/* Return 1 on success.
+ * Return 0 on failure or EOF.
+ * errno is set to *err unless EOF.
+ */
+static int readTagLineRaw (tagFile *const file, int *err)
+{
+	int result = readChunkLine (file, err);
+
 	if (result)
 	{
 		if (copyName (file) != TagSuccess)
@@ -444,7 +570,13 @@ static tagResult parseExtensionFields (tagFile *const file, tagEntry *const entr
 
 				q_len = tail - q;
 
-				/* Unescaping */
+				/* Unescaping, skipping the characters before the first
+				 * backslash; they stand for themselves. */
+				{
+					const size_t plain = strcspn (q, "\\");
+					q += plain;
+					q_len -= plain;
+				}
 				while (*q != '\0')
 				{
 					const char *next = q;
@@ -533,7 +665,12 @@ static unsigned int countContinuousBackslashesBackward(const char *from,
  * buffer. */
 static char *unescapeInPlace (char *q, char **tab, size_t *p_len)
 {
-	char *p = q;
+	/* Most fields have no backslash; the characters before the first
+	 * backslash stand for themselves. */
+	const size_t plain = strcspn (q, "\\");
+	char *p = q + plain;
+
+	*p_len -= plain;
 
 	while (*p != '\0')
 	{
@@ -691,7 +828,7 @@ static int isPseudoTagLine (const char *buffer)
 
 static tagResult readPseudoTags (tagFile *const file, tagFileInfo *const info)
 {
-	fpos_t startOfLine;
+	rt_off_t startOfLine;
 	int err = 0;
 	tagResult result = TagSuccess;
 	const size_t prefixLength = strlen (PseudoTagPrefix);
@@ -707,7 +844,8 @@ static tagResult readPseudoTags (tagFile *const file, tagFileInfo *const info)
 
 	while (1)
 	{
-		if (fgetpos (file->fp, &startOfLine) < 0)
+		startOfLine = tellTagFile (file);
+		if (startOfLine < 0)
 		{
 			err = errno;
 			break;
@@ -805,7 +943,7 @@ static tagResult readPseudoTags (tagFile *const file, tagFileInfo *const info)
 	if (tag_output_mode_u_ctags && tag_output_filesep_slash)
 		file->inputUCtagsMode = 1;
 
-	if (fsetpos (file->fp, &startOfLine) < 0)
+	if (seekTagFile (file, startOfLine, SEEK_SET) < 0)
 		err = errno;
 
 	info->status.error_number = err;
@@ -821,9 +959,9 @@ static int doesFilePointPseudoTag (tagFile *const file, void *unused)
 
 static tagResult gotoFirstLogicalTag (tagFile *const file)
 {
-	fpos_t startOfLine;
+	rt_off_t startOfLine;
 
-	if (readtags_fseek(file->fp, 0, SEEK_SET) == -1)
+	if (seekTagFile (file, 0, SEEK_SET) == -1)
 	{
 		file->err = errno;
 		return TagFailure;
@@ -831,7 +969,8 @@ static tagResult gotoFirstLogicalTag (tagFile *const file)
 
 	while (1)
 	{
-		if (fgetpos (file->fp, &startOfLine) < 0)
+		startOfLine = tellTagFile (file);
+		if (startOfLine < 0)
 		{
 			file->err = errno;
 			return TagFailure;
@@ -845,7 +984,7 @@ static tagResult gotoFirstLogicalTag (tagFile *const file)
 		if (!isPseudoTagLine (file->line.buffer))
 			break;
 	}
-	if (fsetpos (file->fp, &startOfLine) < 0)
+	if (seekTagFile (file, startOfLine, SEEK_SET) < 0)
 	{
 		file->err = errno;
 		return TagFailure;
@@ -853,6 +992,99 @@ static tagResult gotoFirstLogicalTag (tagFile *const file)
 	return TagSuccess;
 }
 
+/*
+ *  Functions for the companion index, "<tag file>.idx". The index maps
+ *  the hash of a tag name to the offsets of the tag lines having the name,
+ *  so that an exact, case-sensitive lookup reads a few bytes of the index
+ *  and the matching lines only.
+ */
+
+static unsigned long long getIndexValue (const unsigned char *const buf, int size)
+{
+	unsigned long long v = 0;
+
+	while (size-- > 0)
+		v = (v << 8) | buf [size];
+	return v;
+}
+
+/* 32-bit FNV-1a of a tag name. If ESCAPED is non-zero, NAME is the name
+ * as written in a tag file, and it is hashed after unescaping. */
+static unsigned long hashTagName (const char *const name, const size_t length,
+								  const int escaped)
+{
+	unsigned long hash = 2166136261UL;
+	const char *p = name;
+
+	while (p < name + length)
+	{
+		const int c = escaped? readTagCharacter (&p): *p++;
+		hash ^= (unsigned char) c;
+		hash = (hash * 16777619UL) & 0xffffffffUL;
+	}
+	return hash;
+}
+
+static void openIndex (tagFile *const file, const char *const filePath)
+{
+	unsigned char header [TAG_INDEX_HEADER_SIZE];
+	char *indexPath;
+	FILE *fp;
+
+	indexPath = (char *) malloc (strlen (filePath) + sizeof (TAG_INDEX_SUFFIX));
+	if (indexPath == NULL)
+		return;
+	strcpy (indexPath, filePath);
+	strcat (indexPath, TAG_INDEX_SUFFIX);
+	fp = fopen (indexPath, "rb");
+	free (indexPath);
+	if (fp == NULL)
+		return;
+
+	if (fread (header, 1, sizeof (header), fp) != sizeof (header)
+		|| memcmp (header, TAG_INDEX_MAGIC, strlen (TAG_INDEX_MAGIC)) != 0
+		|| getIndexValue (header + 8, 4) != TAG_INDEX_FORMAT
+		|| getIndexValue (header + 12, 4) > TAG_INDEX_MAX_BITS)
+	{
+		fclose (fp);
+		return;
+	}
+
+	file->index.fp = fp;
+	file->index.bits = (unsigned int) getIndexValue (header + 12, 4);
+	file->index.size = getIndexValue (header + 16, 8);
+	file->index.mtime = getIndexValue (header + 24, 8);
+	file->index.mtimeNsec = (unsigned long) getIndexValue (header + 36, 4);
+}
+
+static void closeIndex (tagFile *const file)
+{
+	if (file->index.fp != NULL)
+	{
+		fclose (file->index.fp);
+		file->index.fp = NULL;
+	}
+}
+
+/* Return 1 if the tag file is unchanged since the index was made. */
+static int isIndexFresh (tagFile *const file)
+{
+#ifdef _WIN32
+	struct _stat64 st;
+
+	if (_fstat64 (_fileno (file->fp), &st) != 0)
+		return 0;
+#else
+	struct stat st;
+
+	if (fstat (fileno (file->fp), &st) != 0)
+		return 0;
+#endif
+	return ((unsigned long long) st.st_size == file->index.size
+			&& (unsigned long long) st.st_mtime == file->index.mtime
+			&& (unsigned long) ST_MTIME_NSEC (st) == file->index.mtimeNsec);
+}
+
 static tagFile *initialize (const char *const filePath, tagFileInfo *const info)
 {
 	tagFile *result = (tagFile*) calloc ((size_t) 1, sizeof (tagFile));
@@ -919,6 +1151,8 @@ static tagFile *initialize (const char *const filePath, tagFileInfo *const info)
 	if (readPseudoTags (result, info) == TagFailure)
 		goto file_error;
 
+	openIndex (result, filePath);
+
 	info->status.opened = 1;
 	result->initialized = 1;
 
@@ -926,6 +1160,7 @@ static tagFile *initialize (const char *const filePath, tagFileInfo *const info)
  mem_error:
 	info->status.error_number = ENOMEM;
  file_error:
+	free (result->chunk.addr);
 	free (result->line.buffer);
 	free (result->name.buffer);
 	free (result->fields.list);
@@ -939,7 +1174,9 @@ static tagFile *initialize (const char *const filePath, tagFileInfo *const info)
 static void terminate (tagFile *const file)
 {
 	fclose (file->fp);
+	closeIndex (file);
 
+	free (file->chunk.addr);
 	free (file->line.buffer);
 	free (file->name.buffer);
 	free (file->fields.list);
@@ -1000,7 +1237,7 @@ static const char *readFieldValue (
 
 static int readTagLineSeek (tagFile *const file, const rt_off_t pos)
 {
-	if (readtags_fseek (file->fp, pos, SEEK_SET) < 0)
+	if (seekTagFile (file, pos, SEEK_SET) < 0)
 	{
 		file->err = errno;
 		return 0;
@@ -1078,6 +1315,64 @@ static tagResult findFirstMatchBefore (tagFile *const file)
 	return result;
 }
 
+/* Return 1 if found, 0 if not found in the index, or -1 if the index
+ * cannot be used. The index cannot be used when the tag file has been
+ * changed since the index was made. A file rewritten within the
+ * resolution of its modification time can still look unchanged, so
+ * the caller searches the tag file itself unless a line is found. */
+static int findIndexed (tagFile *const file)
+{
+	unsigned char buf [TAG_INDEX_ENTRY_SIZE];
+	FILE *const fp = file->index.fp;
+	const unsigned int bits = file->index.bits;
+	const unsigned long hash = hashTagName (file->search.name,
+											file->search.nameLength, 0);
+	const unsigned long bucket = (bits == 0)? 0: (hash >> (32 - bits));
+	const rt_off_t entries = TAG_INDEX_HEADER_SIZE
+		+ (((rt_off_t) 1 << bits) + 1) * 4;
+	unsigned long i, end;
+
+	if (! isIndexFresh (file))
+		return -1;
+
+	if (readtags_fseek (fp, TAG_INDEX_HEADER_SIZE + (rt_off_t) bucket * 4, SEEK_SET) < 0
+		|| fread (buf, 1, 8, fp) != 8)
+		return -1;
+	i = (unsigned long) getIndexValue (buf, 4);
+	end = (unsigned long) getIndexValue (buf + 4, 4);
+	if (i < end
+		&& readtags_fseek (fp, entries + (rt_off_t) i * TAG_INDEX_ENTRY_SIZE, SEEK_SET) < 0)
+		return -1;
+
+	for (; i < end  ;  ++i)
+	{
+		unsigned long entryHash;
+
+		if (fread (buf, 1, TAG_INDEX_ENTRY_SIZE, fp) != TAG_INDEX_ENTRY_SIZE)
+			return -1;
+		entryHash = (unsigned long) getIndexValue (buf, 4);
+		if (entryHash < hash)
+			continue;
+		else if (entryHash > hash)
+			break;
+
+		if (seekTagFile (file, (rt_off_t) getIndexValue (buf + 4, 8), SEEK_SET) < 0)
+		{
+			file->err = errno;
+			return -1;
+		}
+		if (! readTagLine (file, &file->err))
+			return -1;
+		/* The index doesn't point to the tag line; it is out of date. */
+		if (file->pos != (rt_off_t) getIndexValue (buf + 4, 8)
+			|| hashTagName (file->name.buffer, strlen (file->name.buffer), 1) != hash)
+			return -1;
+		if (nameComparison (file) == 0)
+			return 1;
+	}
+	return 0;
+}
+
 static tagResult findBinary (tagFile *const file)
 {
 	tagResult result = TagFailure;
@@ -1176,18 +1471,33 @@ static tagResult find (tagFile *const file, tagEntry *const entry,
 	file->search.nameLength = strlen (name);
 	file->search.partial = (options & TAG_PARTIALMATCH) != 0;
 	file->search.ignorecase = (options & TAG_IGNORECASE) != 0;
-	if (readtags_fseek (file->fp, 0, SEEK_END) < 0)
+	if (file->index.fp != NULL
+		&& !file->search.partial  &&  !file->search.ignorecase)
+	{
+		const int found = findIndexed (file);
+		if (found > 0)
+		{
+			file->size = (rt_off_t) file->index.size;
+			result = TagSuccess;
+			goto found;
+		}
+		if (found < 0)
+			closeIndex (file);
+		if (file->err)
+			return TagFailure;
+	}
+	if (seekTagFile (file, 0, SEEK_END) < 0)
 	{
 		file->err = errno;
 		return TagFailure;
 	}
-	file->size = readtags_ftell (file->fp);
+	file->size = tellTagFile (file);
 	if (file->size == -1)
 	{
 		file->err = errno;
 		return TagFailure;
 	}
-	if (readtags_fseek(file->fp, 0, SEEK_SET) == -1)
+	if (seekTagFile (file, 0, SEEK_SET) == -1)
 	{
 		file->err = errno;
 		return TagFailure;
@@ -1206,6 +1516,7 @@ static tagResult find (tagFile *const file, tagEntry *const entry,
 			return TagFailure;
 	}
 
+ found:
 	if (result != TagSuccess)
 		file->search.pos = file->size;
 	else
@@ -1260,7 +1571,7 @@ static tagResult findPseudoTag (tagFile *const file, int rewindBeforeFinding, ta
 
 	if (rewindBeforeFinding)
 	{
-		if (readtags_fseek(file->fp, 0, SEEK_SET) == -1)
+		if (seekTagFile (file, 0, SEEK_SET) == -1)
 		{
 			file->err = errno;
 			return TagFailure;
@@ -226,6 +226,9 @@ extern const char *tagsField (const tagEntry *const entry, const char *const key
 *  will be populated with information about the tag file entry. If a tag file
 *  is sorted using the C locale, a binary search algorithm is used to search
 *  the tag file, resulting in very fast tag lookups, even in huge tag files.
+*  If "<tag file>.idx" written by "ctags --index" exists and is up to date,
+*  the index is used for a case-sensitive full match instead, whether the tag
+*  file is sorted or not.
 *  Various options controlling the matches can be combined by bit-wise or-ing
 *  certain values together. The available values are:
 *
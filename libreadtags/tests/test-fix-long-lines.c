@@ -0,0 +1,149 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released into the public domain.
+*
+*   Testing lines crossing, or longer than, the buffer through which
+*   a tag file is read.
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define	TAGS "./remove-me-after-testing-long-lines.tags"
+#define COUNT 20000
+#define LONG_NTH 10000
+#define LONG_LENGTH 300000
+
+static int
+make_tags (const char *output)
+{
+	FILE *fp = fopen (output, "wb");
+	if (fp == NULL)
+		return 1;
+
+	fputs ("!_TAG_FILE_FORMAT\t2\t/extended format/\n", fp);
+	fputs ("!_TAG_FILE_SORTED\t1\t/0=unsorted, 1=sorted, 2=foldcase/\n", fp);
+	for (unsigned int i = 0; i < COUNT; i++)
+	{
+		fprintf (fp, "tag%05u\tinput.c\t/^", i);
+		if (i == LONG_NTH)
+		{
+			for (unsigned int j = 0; j < LONG_LENGTH; j++)
+				fputc ('x', fp);
+		}
+		else
+			fprintf (fp, "int tag%05u;", i);
+		/* The last line has no newline. Some lines end with CRLF. */
+		if (i == COUNT - 1)
+			fputs ("$/;\"\tv", fp);
+		else
+			fputs ((i % 3)? "$/;\"\tv\n": "$/;\"\tv\r\n", fp);
+	}
+	return (fclose (fp) == 0)? 0: 1;
+}
+
+static int
+check_entry (tagEntry *e, unsigned int i)
+{
+	char name [16];
+
+	snprintf (name, sizeof (name), "tag%05u", i);
+	if (strcmp (e->name, name) != 0)
+	{
+		fprintf (stderr, "unexpected name: %s (expected: %s)\n", e->name, name);
+		return 1;
+	}
+	if (e->kind == NULL || strcmp (e->kind, "v") != 0)
+	{
+		fprintf (stderr, "unexpected kind of %s: %s\n", name, e->kind? e->kind: "(null)");
+		return 1;
+	}
+	if (i == LONG_NTH && strlen (e->address.pattern) != LONG_LENGTH + 4)
+	{
+		fprintf (stderr, "unexpected length of the long pattern: %zu\n",
+				 strlen (e->address.pattern));
+		return 1;
+	}
+	return 0;
+}
+
+static int
+check_tags (const char *tags)
+{
+	tagFileInfo info;
+	tagEntry e;
+	tagResult r;
+	unsigned int i;
+
+	fprintf (stderr, "opening %s...", tags);
+	tagFile *t = tagsOpen (tags, &info);
+	if (t == NULL)
+	{
+		fprintf (stderr, "failed\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "reading all entries...");
+	for (i = 0, r = tagsFirst (t, &e); r == TagSuccess; i++, r = tagsNext (t, &e))
+	{
+		if (check_entry (&e, i))
+			return 1;
+	}
+	if (i != COUNT || tagsGetErrno (t) != 0)
+	{
+		fprintf (stderr, "%u entries read (expected: %u, errno: %d)\n",
+				 i, COUNT, tagsGetErrno (t));
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "finding each entry...");
+	for (i = 0; i < COUNT; i++)
+	{
+		char name [16];
+
+		snprintf (name, sizeof (name), "tag%05u", i);
+		if (tagsFind (t, &e, name, TAG_FULLMATCH | TAG_OBSERVECASE) != TagSuccess)
+		{
+			fprintf (stderr, "not found: %s\n", name);
+			return 1;
+		}
+		if (check_entry (&e, i))
+			return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	tagsClose (t);
+	return 0;
+}
+
+int
+main (void)
+{
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (make_tags (TAGS))
+	{
+		fprintf (stderr, "failed to make %s\n", TAGS);
+		unlink (TAGS);
+		return 99;
+	}
+
+	int r = check_tags (TAGS);
+	unlink (TAGS);
+	return r;
+}
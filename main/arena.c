@@ -0,0 +1,171 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines a region based allocator. An arena takes memory from the
+*   system in large chunks, and allocates objects from the chunks by
+*   advancing a pointer. All the chunks are freed at once when the arena
+*   is deleted.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arena_p.h"
+#include "debug.h"
+#include "routines.h"
+
+/*
+*   MACROS
+*/
+#define ARENA_ALIGNMENT (2 * sizeof (void *))
+#define ARENA_MAX_CHUNK_SIZE (1024 * 1024)
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sArenaChunk {
+	char *base;
+	size_t size;
+} arenaChunk;
+
+struct sArena {
+	/* Sorted by base for arenaOwns () */
+	arenaChunk *chunks;
+	unsigned int count;
+	unsigned int allocated;
+
+	/* Where the next object is taken from */
+	char *next;
+	char *end;
+	size_t chunkSize;
+
+	unsigned long allocations;
+	size_t bytes;
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+extern arena *arenaNew (size_t chunkSize)
+{
+	arena *a = xCalloc (1, arena);
+
+	a->chunkSize = chunkSize < ARENA_ALIGNMENT? ARENA_ALIGNMENT: chunkSize;
+	return a;
+}
+
+extern void arenaDelete (arena *a)
+{
+	for (unsigned int i = 0; i < a->count; i++)
+		eFree (a->chunks [i].base);
+	if (a->chunks)
+		eFree (a->chunks);
+	eFree (a);
+}
+
+static char *addChunk (arena *a, size_t size)
+{
+	char *base = xCalloc (size, char);
+	unsigned int i;
+
+	if (a->count == a->allocated)
+	{
+		a->allocated = a->allocated? a->allocated * 2: 8;
+		a->chunks = xRealloc (a->chunks, a->allocated, arenaChunk);
+	}
+
+	for (i = a->count;
+		 i > 0 && (uintptr_t) a->chunks [i - 1].base > (uintptr_t) base;
+		 i--)
+		a->chunks [i] = a->chunks [i - 1];
+	a->chunks [i].base = base;
+	a->chunks [i].size = size;
+	a->count++;
+
+	return base;
+}
+
+static void *allocate (arena *a, size_t size, size_t alignment)
+{
+	size_t padding = (alignment - ((uintptr_t) a->next % alignment)) % alignment;
+	char *p;
+
+	a->allocations++;
+	a->bytes += size;
+
+	if (a->next && padding + size <= (size_t) (a->end - a->next))
+	{
+		p = a->next + padding;
+		a->next = p + size;
+		return p;
+	}
+
+	/* A large object gets a chunk for itself so that the space left in
+	 * the current chunk is not wasted. */
+	if (size > a->chunkSize / 4)
+		return addChunk (a, size);
+
+	if (a->count > 0 && a->chunkSize < ARENA_MAX_CHUNK_SIZE)
+		a->chunkSize *= 2;
+	p = addChunk (a, a->chunkSize);
+	a->next = p + size;
+	a->end = p + a->chunkSize;
+	return p;
+}
+
+extern void *arenaAlloc (arena *a, size_t size)
+{
+	return allocate (a, size? size: 1, ARENA_ALIGNMENT);
+}
+
+extern char *arenaStrdup (arena *a, const char *str)
+{
+	size_t length = strlen (str);
+	char *p = allocate (a, length + 1, 1);
+
+	memcpy (p, str, length + 1);
+	return p;
+}
+
+extern bool arenaOwns (const arena *a, const void *p)
+{
+	uintptr_t c = (uintptr_t) p;
+	unsigned int low = 0, high = a->count;
+
+	while (low < high)
+	{
+		unsigned int mid = low + (high - low) / 2;
+		const arenaChunk *chunk = a->chunks + mid;
+
+		if (c < (uintptr_t) chunk->base)
+			high = mid;
+		else if (c - (uintptr_t) chunk->base >= chunk->size)
+			low = mid + 1;
+		else
+			return true;
+	}
+	return false;
+}
+
+extern unsigned int arenaCountChunks (const arena *a)
+{
+	return a->count;
+}
+
+extern unsigned long arenaCountAllocations (const arena *a)
+{
+	return a->allocations;
+}
+
+extern size_t arenaCountBytes (const arena *a)
+{
+	return a->bytes;
+}
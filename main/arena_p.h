@@ -0,0 +1,47 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines a region based allocator. Objects allocated from an arena
+*   cannot be freed one by one; all of them are freed at once when the
+*   arena is deleted.
+*/
+#ifndef CTAGS_MAIN_ARENA_PRIVATE_H
+#define CTAGS_MAIN_ARENA_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stddef.h>
+
+/*
+*   DATA DECLARATIONS
+*/
+struct sArena;
+typedef struct sArena arena;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern arena *arenaNew (size_t chunkSize);
+extern void arenaDelete (arena *a);
+
+/* The returned memory is aligned for any type, and filled with zero. */
+extern void *arenaAlloc (arena *a, size_t size);
+extern char *arenaStrdup (arena *a, const char *str);
+
+/* Return true if P points to memory allocated from A. */
+extern bool arenaOwns (const arena *a, const void *p);
+
+/* The number of calls of arenaAlloc(), and the number of bytes
+ * requested by them. */
+extern unsigned long arenaCountAllocations (const arena *a);
+extern size_t arenaCountBytes (const arena *a);
+/* The number of the chunks allocated from the system */
+extern unsigned int arenaCountChunks (const arena *a);
+
+#endif  /* CTAGS_MAIN_ARENA_PRIVATE_H */
@@ -39,10 +39,12 @@
 #include <stdint.h>
 #include <limits.h>  /* to define INT_MAX */
 
+#include "arena_p.h"
 #include "debug.h"
 #include "entry_p.h"
 #include "field.h"
 #include "fmt_p.h"
+#include "htable.h"
 #include "kind.h"
 #include "nestlevel.h"
 #include "options_p.h"
@@ -55,6 +57,7 @@
 #include "parse_p.h"
 #include "ptrarray.h"
 #include "sort_p.h"
+#include "stats_p.h"
 #include "strlist.h"
 #include "subparser_p.h"
 #include "trashbox.h"
@@ -96,7 +99,32 @@ typedef struct eTagFile {
 	unsigned int corkFlags;
 	ptrArray *corkQueue;
 
+	/* The entries in corkQueue and their strings are allocated from
+	   corkArena, and released at once in uncorkTagFile().
+	   corkStrings interns the strings often repeated between
+	   entries like typeRef and access. */
+	arena *corkArena;
+	hashTable *corkStrings;
+	unsigned long corkInterned;
+
 	bool patternCacheValid;
+
+	/* Where pseudo tags go while running as a worker of --jobs.
+	   NULL means they go to mio. */
+	MIO *ptagMio;
+
+	/* With --update, the new tags are written to a temporary file,
+	   and merged into the existing tag file in closeTagFile().
+	   reparsedInputs holds the names of input files, as written in
+	   the tag file, parsed in this run. A worker of --jobs writes the
+	   names to inputListMio instead. */
+	bool updating;
+	hashTable *reparsedInputs;
+	MIO *inputListMio;
+
+	/* In interactive mode, the tags written to mio are passed to
+	   streamMio after each input file. */
+	MIO *streamMio;
 } tagFile;
 
 typedef struct sTagEntryInfoX  {
@@ -119,7 +147,14 @@ static tagFile TagFile = {
 	NULL,                /* vLine */
 	.cork = false,
 	.corkQueue = NULL,
+	.corkArena = NULL,
+	.corkStrings = NULL,
 	.patternCacheValid = false,
+	.ptagMio = NULL,
+	.updating = false,
+	.reparsedInputs = NULL,
+	.inputListMio = NULL,
+	.streamMio = NULL,
 };
 
 static bool TagsToStdout = false;
@@ -144,6 +179,8 @@ extern void freeTagFileResources (void)
 	if (TagFile.directory != NULL)
 		eFree (TagFile.directory);
 	vStringDelete (TagFile.vLine);
+	if (TagFile.reparsedInputs)
+		hashTableDelete (TagFile.reparsedInputs);
 }
 
 extern const char *tagFileName (void)
@@ -379,6 +416,34 @@ static bool isTagFile (const char *const filename)
 	return ok;
 }
 
+/*  Returns the value of !_TAG_FILE_SORTED in the tag file, or -1 if the
+ *  file doesn't have it.
+ */
+static int getTagFileSortOrder (const char *const filename)
+{
+	const char *const ptag = PSEUDO_TAG_PREFIX "TAG_FILE_SORTED\t";
+	int result = -1;
+	MIO *const mio = mio_new_file (filename, "rb");
+	const char *line;
+
+	if (mio == NULL)
+		return result;
+
+	while ((line = readLineRaw (TagFile.vLine, mio)) != NULL
+		   && strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+	{
+		if (strncmp (line, ptag, strlen (ptag)) == 0)
+		{
+			const char c = line [strlen (ptag)];
+			if (c >= '0'  &&  c <= '9')
+				result = c - '0';
+			break;
+		}
+	}
+	mio_unref (mio);
+	return result;
+}
+
 extern void openTagFile (void)
 {
 	setDefaultTagFileName ();
@@ -391,13 +456,10 @@ extern void openTagFile (void)
 	 */
 	if (TagsToStdout)
 	{
-		if (Option.interactive == INTERACTIVE_SANDBOX)
-		{
-			TagFile.mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
-			TagFile.name = NULL;
-		}
-		else
-			TagFile.mio = tempFile ("w+", &TagFile.name);
+		/* The tags are sorted in memory and written to stdout at once
+		   in closeTagFile(). */
+		TagFile.mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+		TagFile.name = NULL;
 		if (isXtagEnabled (XTAG_PSEUDO_TAGS))
 			addCommonPseudoTags ();
 	}
@@ -412,7 +474,30 @@ extern void openTagFile (void)
 			  "\"%s\" doesn't look like a tag file; I refuse to overwrite it.",
 				  TagFile.name);
 
-		if (Option.etags)
+		if (Option.update  &&  fileExists)
+		{
+			/* The new tags are merged into the lines of the existing tag
+			   file, which must be sorted in the same way. */
+			static const char *const sortNames [] = { "no", "yes", "foldcase" };
+			const int sorted = getTagFileSortOrder (TagFile.name);
+			if (sorted != -1  &&  sorted != (int) Option.sorted)
+				error (FATAL, "\"%s\" is sorted with --sort=%s; cannot update it with --sort=%s",
+					   TagFile.name,
+					   (sorted < (int) ARRAY_SIZE (sortNames))? sortNames [sorted]: "?",
+					   sortNames [Option.sorted]);
+
+			/* The existing tag file is rewritten in closeTagFile(). */
+			eFree (TagFile.name);
+			TagFile.name = NULL;
+			TagFile.mio = tempFile ("w+", &TagFile.name);
+			TagFile.updating = true;
+			if (TagFile.reparsedInputs == NULL)
+				TagFile.reparsedInputs = hashTableNew (1021, hashCstrhash, hashCstreq,
+													   eFree, NULL);
+			if (isXtagEnabled (XTAG_PSEUDO_TAGS))
+				addCommonPseudoTags ();
+		}
+		else if (Option.etags)
 		{
 			if (Option.append  &&  fileExists)
 				TagFile.mio = mio_new_file (TagFile.name, "a+b");
@@ -433,7 +518,8 @@ extern void openTagFile (void)
 			}
 			else
 			{
-				TagFile.mio = mio_new_file (TagFile.name, "w");
+				/* --cache reads the tags written for each input file back. */
+				TagFile.mio = mio_new_file (TagFile.name, Option.cache? "w+": "w");
 				if (TagFile.mio != NULL && isXtagEnabled (XTAG_PSEUDO_TAGS))
 					addCommonPseudoTags ();
 			}
@@ -447,7 +533,7 @@ extern void openTagFile (void)
 		if (TagsToStdout)
 			TagFile.directory = eStrdup (CurrentDirectory);
 		else
-			TagFile.directory = absoluteDirname (TagFile.name);
+			TagFile.directory = absoluteDirname (Option.tagFileName);
 	}
 }
 
@@ -544,17 +630,75 @@ static void sortTagFile (void)
 		if (Option.sorted != SO_UNSORTED)
 		{
 			verbose ("sorting tag file\n");
+			if (TagsToStdout  &&  TagFile.name == NULL)
+				memorySortTags (TagFile.mio);
+			else
+			{
 #ifdef EXTERNAL_SORT
-			externalSortTags (TagsToStdout, TagFile.mio);
+				externalSortTags (TagsToStdout, TagFile.mio);
 #else
-			internalSortTagFile ();
+				internalSortTagFile ();
 #endif
+			}
 		}
 		else if (TagsToStdout)
 			catFile (TagFile.mio);
 	}
 }
 
+/*
+ *  The tags sent to stdout are kept in memory up to TAG_MEMORY_LIMIT
+ *  bytes, and sorted there in closeTagFile (). Beyond it, they are moved
+ *  to a temporary file, and sorted as a tag file on disk is, with bounded
+ *  memory.
+ */
+
+#ifdef DEBUG
+#define TAG_MEMORY_LIMIT (16*1024)
+#else
+#define TAG_MEMORY_LIMIT (64*1024*1024)
+#endif
+
+static void spillLargeTagMemory (void)
+{
+	size_t size;
+	unsigned char *data;
+
+	if (! TagsToStdout  ||  TagFile.name != NULL  ||  TagFile.streamMio != NULL)
+		return;
+
+	data = mio_memory_get_data (TagFile.mio, &size);
+	if (data == NULL  ||  size <= TAG_MEMORY_LIMIT)
+		return;
+
+	const long offset = mio_tell (TagFile.mio);
+	MIO *const mio = tempFile ("w+", &TagFile.name);
+
+	verbose ("moving %lu bytes of tags to %s\n", (unsigned long) size, TagFile.name);
+	if (mio_write (mio, data, 1, size) < size
+		|| mio_seek (mio, offset, SEEK_SET) != 0)
+		error (FATAL | PERROR, "cannot write tags to %s", TagFile.name);
+	mio_unref (TagFile.mio);
+	TagFile.mio = mio;
+}
+
+static void updateTagFile (void)
+{
+	MIO *const mio = mio_new_file (TagFile.name, "r");
+
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open tag file: %s", TagFile.name);
+
+	verbose ("updating tag file\n");
+	TagFile.numTags.prev = updateSortedTags (mio, Option.tagFileName,
+											 TagFile.reparsedInputs);
+	mio_unref (mio);
+
+	remove (TagFile.name);  /* remove temporary file */
+	hashTableClear (TagFile.reparsedInputs);
+	TagFile.updating = false;
+}
+
 static void resizeTagFile (const long newSize)
 {
 	int result;
@@ -629,7 +773,10 @@ extern void closeTagFile (const bool resize)
 				TagFile.name? TagFile.name: "<mio>", size, desiredSize); )
 		resizeTagFile (desiredSize);
 	}
-	sortTagFile ();
+	if (TagFile.updating)
+		updateTagFile ();
+	else
+		sortTagFile ();
 	if (TagsToStdout)
 	{
 		if (mio_unref (TagFile.mio) != 0)
@@ -644,6 +791,264 @@ extern void closeTagFile (const bool resize)
 	TagFile.name = NULL;
 }
 
+/*
+ *  Interactive mode (--_interactive) support
+ *
+ *  The tags for a request are passed to the client after each input file
+ *  instead of at the end of the request. They are still written to a
+ *  memory stream first because a parser may rewind the tag file to
+ *  rescan its input. The memory is reused for the next input file.
+ */
+
+extern void openTagStream (MIO *stream)
+{
+	TagsToStdout = true;
+
+	if (TagFile.vLine == NULL)
+		TagFile.vLine = vStringNew ();
+
+	TagFile.mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+	TagFile.name = NULL;
+	TagFile.streamMio = mio_ref (stream);
+	if (isXtagEnabled (XTAG_PSEUDO_TAGS))
+		addCommonPseudoTags ();
+
+	if (TagFile.directory == NULL)
+		TagFile.directory = eStrdup (CurrentDirectory);
+}
+
+extern void flushTagStream (void)
+{
+	long length = mio_tell (TagFile.mio);
+
+	if (length > 0)
+	{
+		size_t size;
+		unsigned char *data = mio_memory_get_data (TagFile.mio, &size);
+
+		Assert ((size_t) length <= size);
+		mio_write (TagFile.streamMio, data, 1, (size_t) length);
+		mio_seek (TagFile.mio, 0L, SEEK_SET);
+	}
+	mio_flush (TagFile.streamMio);
+}
+
+extern void closeTagStream (void)
+{
+	flushTagStream ();
+
+	mio_unref (TagFile.mio);
+	TagFile.mio = NULL;
+	mio_unref (TagFile.streamMio);
+	TagFile.streamMio = NULL;
+}
+
+/*
+ *  Parallel jobs (--jobs) support
+ *
+ *  Each worker process writes tags to its own temporary file. Pseudo tags
+ *  emitted by parsers go to another temporary file so that the parent
+ *  process can drop the duplicates written by more than one worker.
+ */
+
+extern void flushTagFile (void)
+{
+	mio_flush (TagFile.mio);
+	abort_if_ferror (TagFile.mio);
+}
+
+extern void noteReparsedInputFile (const char *const fileName)
+{
+	if (TagFile.inputListMio)
+	{
+		vString *tagPath = getTagPathForFile (fileName);
+		mio_puts (TagFile.inputListMio, vStringValue (tagPath));
+		mio_putc (TagFile.inputListMio, '\n');
+		vStringDelete (tagPath);
+	}
+	else if (TagFile.updating)
+	{
+		vString *tagPath = getTagPathForFile (fileName);
+		if (hashTableHasItem (TagFile.reparsedInputs, vStringValue (tagPath)))
+			vStringDelete (tagPath);
+		else
+			hashTablePutItem (TagFile.reparsedInputs, vStringDeleteUnwrap (tagPath),
+							  TagFile.reparsedInputs);
+	}
+}
+
+/* Must be called in a worker process, just after forking.
+   inputsName can be NULL if the parent process doesn't need the
+   list of parsed input files. */
+extern void redirectTagFileForJob (const char *const tagsName, const char *const ptagsName,
+								   const char *const inputsName)
+{
+	/* Don't close the inherited TagFile.mio here; closing it may
+	   move the file offset shared with the parent process. */
+	TagFile.mio = mio_new_file (tagsName, "w+");
+	if (TagFile.mio == NULL)
+		error (FATAL | PERROR, "cannot open tag file for job: %s", tagsName);
+	TagFile.ptagMio = mio_new_file (ptagsName, "w");
+	if (TagFile.ptagMio == NULL)
+		error (FATAL | PERROR, "cannot open pseudo tag file for job: %s", ptagsName);
+	if (inputsName)
+	{
+		TagFile.inputListMio = mio_new_file (inputsName, "w");
+		if (TagFile.inputListMio == NULL)
+			error (FATAL | PERROR, "cannot open input file list for job: %s", inputsName);
+	}
+	TagFile.updating = false;
+
+	if (TagFile.name)
+		eFree (TagFile.name);
+	TagFile.name = eStrdup (tagsName);
+	TagFile.numTags.added = 0;
+	TagFile.numTags.prev = 0;
+}
+
+/* Returns the number of tags written by the worker. */
+extern unsigned long closeJobTagFile (const bool resize)
+{
+	long desiredSize, size;
+
+	if (mio_unref (TagFile.ptagMio) != 0)
+		error (FATAL | PERROR, "cannot close pseudo tag file for job");
+	TagFile.ptagMio = NULL;
+	if (TagFile.inputListMio)
+	{
+		if (mio_unref (TagFile.inputListMio) != 0)
+			error (FATAL | PERROR, "cannot close input file list for job");
+		TagFile.inputListMio = NULL;
+	}
+
+	mio_flush (TagFile.mio);
+	abort_if_ferror (TagFile.mio);
+	desiredSize = mio_tell (TagFile.mio);
+	mio_seek (TagFile.mio, 0L, SEEK_END);
+	size = mio_tell (TagFile.mio);
+	if (mio_unref (TagFile.mio) != 0)
+		error (FATAL | PERROR, "cannot close tag file for job");
+	TagFile.mio = NULL;
+
+	if (resize  &&  desiredSize < size)
+		resizeTagFile (desiredSize);
+
+	return TagFile.numTags.added;
+}
+
+extern void mergeJobPseudoTagFiles (char *const *const ptagsNames, const unsigned int count)
+{
+	hashTable *seen = hashTableNew (127, hashCstrhash, hashCstreq, eFree, NULL);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		MIO *const mio = mio_new_file (ptagsNames [i], "r");
+		if (mio == NULL)
+			error (FATAL | PERROR, "cannot open pseudo tag file for job: %s", ptagsNames [i]);
+
+		const char *line;
+		while ((line = readLineRaw (TagFile.vLine, mio)) != NULL)
+		{
+			if (hashTableHasItem (seen, line))
+				continue;
+			hashTablePutItem (seen, eStrdup (line), seen);
+
+			mio_puts (TagFile.mio, line);
+			++TagFile.numTags.added;
+
+			const char *const tab = strchr (line, '\t');
+			rememberMaxLengths (tab? (size_t)(tab - line): strlen (line),
+								vStringLength (TagFile.vLine));
+		}
+		mio_unref (mio);
+	}
+	abort_if_ferror (TagFile.mio);
+
+	hashTableDelete (seen);
+}
+
+extern void mergeJobInputFileList (const char *const inputsName)
+{
+	MIO *const mio = mio_new_file (inputsName, "r");
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open input file list for job: %s", inputsName);
+
+	vString *const tagPath = vStringNew ();
+	while (readLineRaw (tagPath, mio) != NULL)
+	{
+		vStringStripNewline (tagPath);
+		if (TagFile.updating
+			&& !hashTableHasItem (TagFile.reparsedInputs, vStringValue (tagPath)))
+			hashTablePutItem (TagFile.reparsedInputs, vStringStrdup (tagPath),
+							  TagFile.reparsedInputs);
+	}
+	vStringDelete (tagPath);
+	mio_unref (mio);
+}
+
+extern void mergeJobTagFile (const char *const tagsName, const unsigned long added)
+{
+	enum { BufferSize = 64 * 1024 };
+	MIO *const mio = mio_new_file (tagsName, "rb");
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open tag file for job: %s", tagsName);
+
+	char *const buffer = xMalloc (BufferSize, char);
+	size_t n;
+	while ((n = mio_read (mio, buffer, 1, BufferSize)) > 0)
+	{
+		spillLargeTagMemory ();
+		if (mio_write (TagFile.mio, buffer, 1, n) < n)
+			error (FATAL | PERROR, "cannot write tag file");
+	}
+	eFree (buffer);
+	mio_unref (mio);
+
+	TagFile.numTags.added += added;
+}
+
+/*
+ *  Tag cache (--cache) support
+ */
+
+extern long tagFileOffset (void)
+{
+	return mio_tell (TagFile.mio);
+}
+
+/* Append the tag lines written after offset to lines, skipping
+   pseudo tags. */
+extern void copyTagLinesSince (const long offset, vString *const lines,
+							   unsigned long *const count)
+{
+	const long end = mio_tell (TagFile.mio);
+	vString *const vLine = vStringNew ();
+
+	*count = 0;
+	if (mio_seek (TagFile.mio, offset, SEEK_SET) != 0)
+		error (FATAL | PERROR, "cannot seek in tag file");
+	while (mio_tell (TagFile.mio) < end
+		   && readLineRaw (vLine, TagFile.mio) != NULL)
+	{
+		if (strncmp (vStringValue (vLine), "!_", 2) == 0)
+			continue;
+		vStringCat (lines, vLine);
+		++*count;
+	}
+	vStringDelete (vLine);
+	if (mio_seek (TagFile.mio, end, SEEK_SET) != 0)
+		error (FATAL | PERROR, "cannot seek in tag file");
+}
+
+extern void writeCachedTagLines (const char *const lines, const size_t length,
+								 const unsigned long count)
+{
+	spillLargeTagMemory ();
+	if (length > 0 && mio_write (TagFile.mio, lines, 1, length) < length)
+		error (FATAL | PERROR, "cannot write tag file");
+	TagFile.numTags.added += count;
+}
+
 /*
  *  Tag entry management
  */
@@ -651,22 +1056,24 @@ extern void closeTagFile (const bool resize)
 /*  This function copies the current line out to a specified file. It has no
  *  effect on the fileGetc () function.  During copying, any '\' characters
  *  are doubled and a leading '^' or trailing '$' is also quoted. End of line
- *  characters (line feed or carriage return) are dropped.
+ *  characters (line feed or carriage return) are dropped. LINE may not be
+ *  terminated with '\0'; at most LINE_LEN bytes are looked at.
  */
 static size_t appendInputLine (int putc_func (char , void *), const char *const line,
-							   unsigned int patternLengthLimit,
+							   size_t line_len, unsigned int patternLengthLimit,
 							   void * data, bool *omitted)
 {
 	size_t length = 0;
 	const char *p;
+	const char *const end = line + line_len;
 	int extraLength = 0;
 
 	/*  Write everything up to, but not including, a line end character.
 	 */
 	*omitted = false;
-	for (p = line  ;  *p != '\0'  ;  ++p)
+	for (p = line  ;  p < end && *p != '\0'  ;  ++p)
 	{
-		const int next = *(p + 1);
+		const int next = (p + 1 < end)? *(p + 1): '\0';
 		const int c = *p;
 
 		if (c == CRETURN  ||  c == NEWLINE)
@@ -861,7 +1268,7 @@ static int   makePatternStringCommon (const tagEntryInfo *const tag,
 {
 	int length = 0;
 
-	char *line;
+	const char *line;
 	int searchChar;
 	const char *terminator;
 	bool  omitted;
@@ -878,24 +1285,35 @@ static int   makePatternStringCommon (const tagEntryInfo *const tag,
 		&& (memcmp (&tag->filePosition, &cached_location, sizeof(MIOPos)) == 0))
 		return puts_func (vStringValue (cached_pattern), output);
 
-	line = readLineFromBypassForTag (TagFile.vLine, tag, NULL);
+	/* Refer to the line in the buffer of the input stream if possible.
+	 * A line to be truncated is copied and read with seeking. */
+	line = tag->truncateLineAfterTag
+		? NULL
+		: getInputLineAtPosition (tag->filePosition, &line_len);
 	if (line == NULL)
 	{
-		/* This can be occurs if the size of input file is zero, and
-		   an empty regex pattern (//) matches to the input. */
-		line = "";
-		line_len = 0;
-	}
-	else
-		line_len = vStringLength (TagFile.vLine);
+		char *copy = readLineFromBypassForTag (TagFile.vLine, tag, NULL);
+		if (copy == NULL)
+		{
+			/* This can be occurs if the size of input file is zero, and
+			   an empty regex pattern (//) matches to the input. */
+			line = "";
+			line_len = 0;
+		}
+		else
+		{
+			line_len = vStringLength (TagFile.vLine);
 
-	if (tag->truncateLineAfterTag)
-	{
-		size_t truncted_len;
+			if (tag->truncateLineAfterTag)
+			{
+				size_t truncted_len;
 
-		truncted_len = truncateTagLineAfterTag (line, tag->name, false);
-		if (truncted_len > 0)
-			line_len = truncted_len;
+				truncted_len = truncateTagLineAfterTag (copy, tag->name, false);
+				if (truncted_len > 0)
+					line_len = truncted_len;
+			}
+			line = copy;
+		}
 	}
 
 	searchChar = Option.backward ? '?' : '/';
@@ -916,7 +1334,7 @@ static int   makePatternStringCommon (const tagEntryInfo *const tag,
 	length += putc_func(searchChar, output);
 	if ((tag->boundaryInfo & INPUT_BOUNDARY_START) == 0)
 		length += putc_func('^', output);
-	length += appendInputLine (putc_func, line, Option.patternLengthLimit,
+	length += appendInputLine (putc_func, line, line_len, Option.patternLengthLimit,
 							   output, &omitted);
 	length += puts_func (omitted? "": terminator, output);
 	length += putc_func (searchChar, output);
@@ -938,6 +1356,38 @@ extern char* makePatternString (const tagEntryInfo *const tag)
 	return vStringDeleteUnwrap (pattern);
 }
 
+static const char *copyCorkString (const char *str)
+{
+	return arenaStrdup (TagFile.corkArena, str);
+}
+
+static const char *internCorkString (const char *str)
+{
+	char *interned = hashTableGetItem (TagFile.corkStrings, str);
+
+	if (interned)
+	{
+		TagFile.corkInterned++;
+		return interned;
+	}
+
+	interned = arenaStrdup (TagFile.corkArena, str);
+	hashTablePutItem (TagFile.corkStrings, interned, interned);
+	return interned;
+}
+
+static void freeCorkString (const char *str)
+{
+	if (str && !(TagFile.corkArena && arenaOwns (TagFile.corkArena, str)))
+		eFree ((char *)str);
+}
+
+extern void freeTagEntryString (const char **str)
+{
+	freeCorkString (*str);
+	*str = NULL;
+}
+
 static tagField* tagFieldNew (fieldType ftype, const char *value, bool valueOwner)
 {
 	tagField *f = xMalloc (1, tagField);
@@ -986,10 +1436,10 @@ extern void attachParserField (tagEntryInfo *const tag, fieldType ftype, const c
 	if (tag->inCorkQueue)
 	{
 		const char * v;
-		v = eStrdup (value);
+		v = internCorkString (value);
 
 		bool dynfields_allocated = tag->parserFieldsDynamic? true: false;
-		attachParserFieldGeneric (tag, ftype, v, true);
+		attachParserFieldGeneric (tag, ftype, v, false);
 		if (!dynfields_allocated && tag->parserFieldsDynamic)
 			PARSER_TRASH_BOX_TAKE_BACK(tag->parserFieldsDynamic);
 	}
@@ -1043,24 +1493,25 @@ static void copyParserFields (const tagEntryInfo *const tag, tagEntryInfo* slot)
 
 		value = f->value;
 		if (value)
-			value = eStrdup (value);
+			value = internCorkString (value);
 
 		attachParserFieldGeneric (slot,
 								  f->ftype,
 								  value,
-								  true);
+								  false);
 	}
 
 }
 
 static tagEntryInfo *newNilTagEntry (unsigned int corkFlags)
 {
-	tagEntryInfoX *x = xCalloc (1, tagEntryInfoX);
+	tagEntryInfoX *x = arenaAlloc (TagFile.corkArena, sizeof (tagEntryInfoX));
 	x->corkIndex = CORK_NIL;
 	x->symtab = RB_ROOT;
+	RB_CLEAR_NODE (&x->symnode);
 	x->slot.kindIndex = KIND_FILE_INDEX;
 	x->slot.inputFileName = getInputFileName ();
-	x->slot.inputFileName = eStrdup (x->slot.inputFileName);
+	x->slot.inputFileName = copyCorkString (x->slot.inputFileName);
 	return &(x->slot);
 }
 
@@ -1068,15 +1519,16 @@ static tagEntryInfoX *copyTagEntry (const tagEntryInfo *const tag,
 									const char *shareInputFileName,
 									unsigned int corkFlags)
 {
-	tagEntryInfoX *x = xMalloc (1, tagEntryInfoX);
+	tagEntryInfoX *x = arenaAlloc (TagFile.corkArena, sizeof (tagEntryInfoX));
 	x->symtab = RB_ROOT;
+	RB_CLEAR_NODE (&x->symnode);
 	x->corkIndex = CORK_NIL;
 	tagEntryInfo  *slot = (tagEntryInfo *)x;
 
 	*slot = *tag;
 
 	if (slot->pattern)
-		slot->pattern = eStrdup (slot->pattern);
+		slot->pattern = copyCorkString (slot->pattern);
 
 	if (slot->inputFileName == getInputFileName ())
 	{
@@ -1085,39 +1537,39 @@ static tagEntryInfoX *copyTagEntry (const tagEntryInfo *const tag,
 	}
 	else
 	{
-		slot->inputFileName = eStrdup (slot->inputFileName);
+		slot->inputFileName = internCorkString (slot->inputFileName);
 		slot->isInputFileNameShared = 0;
 	}
 
-	slot->name = eStrdup (slot->name);
+	slot->name = copyCorkString (slot->name);
 	if (slot->extensionFields.access)
-		slot->extensionFields.access = eStrdup (slot->extensionFields.access);
+		slot->extensionFields.access = internCorkString (slot->extensionFields.access);
 	if (slot->extensionFields.implementation)
-		slot->extensionFields.implementation = eStrdup (slot->extensionFields.implementation);
+		slot->extensionFields.implementation = internCorkString (slot->extensionFields.implementation);
 	if (slot->extensionFields.inheritance)
-		slot->extensionFields.inheritance = eStrdup (slot->extensionFields.inheritance);
+		slot->extensionFields.inheritance = copyCorkString (slot->extensionFields.inheritance);
 	if (slot->extensionFields.scopeName)
-		slot->extensionFields.scopeName = eStrdup (slot->extensionFields.scopeName);
+		slot->extensionFields.scopeName = internCorkString (slot->extensionFields.scopeName);
 	if (slot->extensionFields.signature)
-		slot->extensionFields.signature = eStrdup (slot->extensionFields.signature);
+		slot->extensionFields.signature = copyCorkString (slot->extensionFields.signature);
 	if (slot->extensionFields.typeRef[0])
-		slot->extensionFields.typeRef[0] = eStrdup (slot->extensionFields.typeRef[0]);
+		slot->extensionFields.typeRef[0] = internCorkString (slot->extensionFields.typeRef[0]);
 	if (slot->extensionFields.typeRef[1])
-		slot->extensionFields.typeRef[1] = eStrdup (slot->extensionFields.typeRef[1]);
+		slot->extensionFields.typeRef[1] = internCorkString (slot->extensionFields.typeRef[1]);
 #ifdef HAVE_LIBXML
 	if (slot->extensionFields.xpath)
-		slot->extensionFields.xpath = eStrdup (slot->extensionFields.xpath);
+		slot->extensionFields.xpath = copyCorkString (slot->extensionFields.xpath);
 #endif
 
 	if (slot->extraDynamic)
 	{
 		unsigned int n = countXtags () - XTAG_COUNT;
-		slot->extraDynamic = xCalloc ((n / 8) + 1, uint8_t);
+		slot->extraDynamic = arenaAlloc (TagFile.corkArena, (n / 8) + 1);
 		memcpy (slot->extraDynamic, tag->extraDynamic, (n / 8) + 1);
 	}
 
 	if (slot->sourceFileName)
-		slot->sourceFileName = eStrdup (slot->sourceFileName);
+		slot->sourceFileName = internCorkString (slot->sourceFileName);
 
 
 	slot->usedParserFields = 0;
@@ -1154,53 +1606,42 @@ static void clearParserFields (tagEntryInfo *const tag)
 	}
 }
 
+/* The entry itself and the strings copied in copyTagEntry () are in
+ * TagFile.corkArena. Only the strings a parser stored to the entry
+ * after queuing it are freed here. */
 static void deleteTagEnry (void *data)
 {
 	tagEntryInfo *slot = data;
 
 	if (slot->kindIndex == KIND_FILE_INDEX)
 	{
-		eFree ((char *)slot->inputFileName);
-		goto out;
+		freeCorkString (slot->inputFileName);
+		return;
 	}
 
-	if (slot->pattern)
-		eFree ((char *)slot->pattern);
+	freeCorkString (slot->pattern);
 
 	if (!slot->isInputFileNameShared)
-		eFree ((char *)slot->inputFileName);
+		freeCorkString (slot->inputFileName);
 
-	eFree ((char *)slot->name);
+	freeCorkString (slot->name);
 
-	if (slot->extensionFields.access)
-		eFree ((char *)slot->extensionFields.access);
-	if (slot->extensionFields.implementation)
-		eFree ((char *)slot->extensionFields.implementation);
-	if (slot->extensionFields.inheritance)
-		eFree ((char *)slot->extensionFields.inheritance);
-	if (slot->extensionFields.scopeName)
-		eFree ((char *)slot->extensionFields.scopeName);
-	if (slot->extensionFields.signature)
-		eFree ((char *)slot->extensionFields.signature);
-	if (slot->extensionFields.typeRef[0])
-		eFree ((char *)slot->extensionFields.typeRef[0]);
-	if (slot->extensionFields.typeRef[1])
-		eFree ((char *)slot->extensionFields.typeRef[1]);
+	freeCorkString (slot->extensionFields.access);
+	freeCorkString (slot->extensionFields.implementation);
+	freeCorkString (slot->extensionFields.inheritance);
+	freeCorkString (slot->extensionFields.scopeName);
+	freeCorkString (slot->extensionFields.signature);
+	freeCorkString (slot->extensionFields.typeRef[0]);
+	freeCorkString (slot->extensionFields.typeRef[1]);
 #ifdef HAVE_LIBXML
-	if (slot->extensionFields.xpath)
-		eFree ((char *)slot->extensionFields.xpath);
+	freeCorkString (slot->extensionFields.xpath);
 #endif
 
-	if (slot->extraDynamic)
-		eFree (slot->extraDynamic);
+	freeCorkString ((const char *)slot->extraDynamic);
 
-	if (slot->sourceFileName)
-		eFree ((char *)slot->sourceFileName);
+	freeCorkString (slot->sourceFileName);
 
 	clearParserFields (slot);
-
- out:
-	eFree (slot);
 }
 
 static void corkSymtabPut (tagEntryInfoX *scope, const char* name, tagEntryInfoX *item)
@@ -1258,6 +1699,7 @@ static void corkSymtabUnlink (tagEntryInfoX *scope, tagEntryInfoX *item)
 {
 	struct rb_root *root = &scope->symtab;
 	rb_erase (&item->symnode, root);
+	RB_CLEAR_NODE (&item->symnode);
 }
 
 extern bool foreachEntriesInScope (int corkIndex,
@@ -1659,6 +2101,7 @@ static void writeTagEntry (const tagEntryInfo *const tag)
 		buildFqTagCache ( (tagEntryInfo *const)tag);
 	}
 
+	spillLargeTagMemory ();
 	length = writerWriteTag (TagFile.mio, tag);
 
 	if (length > 0)
@@ -1678,6 +2121,16 @@ extern bool writePseudoTag (const ptagDesc *desc,
 {
 	int length;
 
+	if (TagFile.ptagMio)
+	{
+		/* The parent process counts the pseudo tags when merging
+		   the outputs of the workers. See mergeJobPseudoTagFiles(). */
+		length = writerWritePtag (TagFile.ptagMio, desc, fileName,
+								  pattern, parserName);
+		abort_if_ferror (TagFile.ptagMio);
+		return (length >= 0);
+	}
+
 	length = writerWritePtag (TagFile.mio, desc, fileName,
 							  pattern, parserName);
 	if (length < 0)
@@ -1697,6 +2150,10 @@ extern void corkTagFile (unsigned int corkFlags)
 	if (TagFile.cork == 1)
 	{
 		TagFile.corkFlags = corkFlags;
+		TagFile.corkArena = arenaNew (4096);
+		TagFile.corkStrings = hashTableNew (127, hashCstrhash, hashCstreq,
+											NULL, NULL);
+		TagFile.corkInterned = 0;
 		TagFile.corkQueue = ptrArrayNew (deleteTagEnry);
 		tagEntryInfo *nil = newNilTagEntry (corkFlags);
 		ptrArrayAdd (TagFile.corkQueue, nil);
@@ -1734,8 +2191,42 @@ extern void uncorkTagFile (void)
 			makeQualifiedTagEntry (tag);
 	}
 
+	/* Every allocation from the arena, and every reuse of an interned
+	   string, is a malloc () and free () pair saved. */
+	addCorkTotals (ptrArrayCount (TagFile.corkQueue) - 1,
+				   arenaCountAllocations (TagFile.corkArena)
+				   + TagFile.corkInterned
+				   - arenaCountChunks (TagFile.corkArena),
+				   TagFile.corkInterned,
+				   arenaCountBytes (TagFile.corkArena));
+
 	ptrArrayDelete (TagFile.corkQueue);
 	TagFile.corkQueue = NULL;
+	hashTableDelete (TagFile.corkStrings);
+	TagFile.corkStrings = NULL;
+	arenaDelete (TagFile.corkArena);
+	TagFile.corkArena = NULL;
+}
+
+/* Drop the entries queued after the first COUNT ones as if they were
+   never made. The memory for them in corkArena is not reused. */
+extern void truncateCorkQueue (size_t count)
+{
+	Assert (TagFile.cork > 0);
+	Assert (count > CORK_NIL && count <= ptrArrayCount (TagFile.corkQueue));
+
+	while (ptrArrayCount (TagFile.corkQueue) > count)
+	{
+		tagEntryInfoX *x = ptrArrayLast (TagFile.corkQueue);
+		int scopeIndex = x->slot.extensionFields.scopeIndex;
+
+		/* The entries are dropped from the last, so the scope has gone
+		   already if it was queued after the entry. */
+		if (!RB_EMPTY_NODE (&x->symnode)
+			&& (size_t) scopeIndex < ptrArrayCount (TagFile.corkQueue))
+			corkSymtabUnlink (ptrArrayItem (TagFile.corkQueue, scopeIndex), x);
+		ptrArrayDeleteLast (TagFile.corkQueue);
+	}
 }
 
 extern tagEntryInfo *getEntryInCorkQueue (int n)
@@ -2020,9 +2511,13 @@ static void markTagExtraBitFull (tagEntryInfo *const tag, xtagType extra, bool m
 		Assert (extra < countXtags ());
 		Assert (XTAG_COUNT <= countXtags ());
 		unsigned int n = countXtags () - XTAG_COUNT;
-		tag->extraDynamic = xCalloc ((n / 8) + 1, uint8_t);
-		if (!tag->inCorkQueue)
+		if (tag->inCorkQueue)
+			tag->extraDynamic = arenaAlloc (TagFile.corkArena, (n / 8) + 1);
+		else
+		{
+			tag->extraDynamic = xCalloc ((n / 8) + 1, uint8_t);
 			PARSER_TRASH_BOX(tag->extraDynamic, eFree);
+		}
 		markTagExtraBitFull (tag, extra, mark);
 		return;
 	}
@@ -2144,18 +2639,23 @@ extern void invalidatePatternCache (void)
 	TagFile.patternCacheValid = false;
 }
 
-extern void tagFilePosition (MIOPos *p)
+/*  The position is an offset rather than a MIOPos because the tags
+ *  kept in memory may be moved to a file in the meantime; see
+ *  spillLargeTagMemory ().
+ */
+extern void tagFilePosition (long *p)
 {
 	/* mini-geany doesn't set TagFile.mio. */
 	if (TagFile.mio == NULL)
 		return;
 
-	if (mio_getpos (TagFile.mio, p) == -1)
+	*p = mio_tell (TagFile.mio);
+	if (*p == -1)
 		error (FATAL|PERROR,
 			   "failed to get file position of the tag file\n");
 }
 
-extern void setTagFilePosition (MIOPos *p, bool truncation)
+extern void setTagFilePosition (long *p, bool truncation)
 {
 	/* mini-geany doesn't set TagFile.mio. */
 	if (TagFile.mio == NULL)
@@ -2166,7 +2666,7 @@ extern void setTagFilePosition (MIOPos *p, bool truncation)
 	if (truncation)
 		t0 = mio_tell (TagFile.mio);
 
-	if (mio_setpos (TagFile.mio, p) == -1)
+	if (mio_seek (TagFile.mio, *p, SEEK_SET) == -1)
 		error (FATAL|PERROR,
 			   "failed to set file position of the tag file\n");
 
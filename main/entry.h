@@ -189,6 +189,13 @@ tagEntryInfo *getEntryInCorkQueue   (int n);
 tagEntryInfo *getEntryOfNestingLevel (const NestingLevel *nl);
 size_t        countEntryInCorkQueue (void);
 
+/* The strings of a tag entry in the cork queue are allocated from an
+ * arena, and may be shared between entries. To replace such a string,
+ * release it with freeTagEntryString() instead of eFree(). The function
+ * stores NULL to *STR. A string allocated with eStrdup() and stored to
+ * the entry is freed when the queue is released. */
+extern void freeTagEntryString (const char **str);
+
 /* If a parser sets (CORK_QUEUE and )CORK_SYMTAB to useCork,
  * the parsesr can use symbol lookup tables for the current input.
  * Each scope has a symbol lookup table.
@@ -31,6 +31,30 @@ extern const char *tagFileName (void);
 extern void openTagFile (void);
 extern void closeTagFile (const bool resize);
 extern void  setupWriter (void *writerClientData);
+
+extern void flushTagFile (void);
+
+/* Interactive mode writes the tags to STREAM through these instead of
+ * openTagFile () and closeTagFile (). */
+extern void openTagStream (MIO *stream);
+extern void flushTagStream (void);
+extern void closeTagStream (void);
+
+extern void noteReparsedInputFile (const char *const fileName);
+
+extern void redirectTagFileForJob (const char *const tagsName, const char *const ptagsName,
+								   const char *const inputsName);
+extern unsigned long closeJobTagFile (const bool resize);
+extern void mergeJobPseudoTagFiles (char *const *const ptagsNames, const unsigned int count);
+extern void mergeJobInputFileList (const char *const inputsName);
+extern void mergeJobTagFile (const char *const tagsName, const unsigned long added);
+
+extern long tagFileOffset (void);
+extern void copyTagLinesSince (const long offset, vString *const lines,
+							   unsigned long *const count);
+extern void writeCachedTagLines (const char *const lines, const size_t length,
+								 const unsigned long count);
+
 extern bool  teardownWriter (const char *inputFilename);
 
 extern unsigned long numTagsAdded(void);
@@ -38,8 +62,8 @@ extern void setNumTagsAdded (unsigned long nadded);
 extern unsigned long numTagsTotal(void);
 extern unsigned long maxTagsLine(void);
 extern void invalidatePatternCache(void);
-extern void tagFilePosition (MIOPos *p);
-extern void setTagFilePosition (MIOPos *p, bool truncation);
+extern void tagFilePosition (long *p);
+extern void setTagFilePosition (long *p, bool truncation);
 extern const char* getTagFileDirectory (void);
 extern void getTagScopeInformation (tagEntryInfo *const tag,
 				    const char **kind, const char **name);
@@ -60,6 +84,8 @@ extern bool writePseudoTag (const ptagDesc *pdesc,
 
 void          corkTagFile(unsigned int corkFlags);
 void          uncorkTagFile(void);
+/* Drop the entries queued after the first COUNT ones. */
+void          truncateCorkQueue(size_t count);
 
 extern void makeFileTag (const char *const fileName);
 
@@ -69,9 +69,12 @@ extern void error (const errorSelection selection,
 }
 
 #ifdef HAVE_JANSSON
+/*  DATA is the FILE to write to; NULL means stdout.
+ */
 bool jsonErrorPrinter (const errorSelection selection, const char *const format, va_list ap,
-					   void *data CTAGS_ATTR_UNUSED)
+					   void *data)
 {
+	FILE *fp = data? data: stdout;
 #define ERR_BUFFER_SIZE 4096
 	static char reason[ERR_BUFFER_SIZE];
 
@@ -92,8 +95,8 @@ bool jsonErrorPrinter (const errorSelection selection, const char *const format,
 		json_object_set_new (response, "errno", json_integer (errno));
 		json_object_set_new (response, "perror", json_string (strerror (errno)));
 	}
-	json_dumpf (response, stdout, JSON_PRESERVE_ORDER);
-	fprintf (stdout, "\n");
+	json_dumpf (response, fp, JSON_PRESERVE_ORDER);
+	fprintf (fp, "\n");
 
 	json_decref (response);
 
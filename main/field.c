@@ -1580,7 +1580,7 @@ static EsObject* getFieldValueForName (const tagEntryInfo *tag, const fieldDefin
 
 static EsObject* setFieldValueForName (tagEntryInfo *tag, const fieldDefinition *fdef, const EsObject *val)
 {
-	eFree ((char*) tag->name);
+	freeTagEntryString (&tag->name);
 	const char *cstr = opt_string_get_cstr (val);
 	tag->name = eStrdup (cstr);
 	return es_false;
@@ -1677,8 +1677,7 @@ static EsObject* setFieldValueForTyperef (tagEntryInfo *tag, const fieldDefiniti
 	}
 
 	for (int i = 0; i < 2; i++)
-		if (tmp [i])
-			eFree ((char*)tmp[i]);
+		freeTagEntryString (tmp + i);
 
 	return es_false;
 }
@@ -1791,8 +1790,7 @@ static EsObject* getFieldValueForCOMMON (const char *field, const tagEntryInfo *
 
 static EsObject* setFieldValueForCOMMON (const char **field, tagEntryInfo *tag, const fieldDefinition *fdef, const EsObject *obj)
 {
-	if (*field)
-		eFree ((char *)*field);
+	freeTagEntryString (field);
 
 	const char *str = opt_string_get_cstr (obj);
 	*field = eStrdup (str);
@@ -1899,18 +1897,13 @@ static EsObject* setFieldValueForInherits (tagEntryInfo *tag, const fieldDefinit
 {
 	if (es_object_get_type (obj) == OPT_TYPE_STRING)
 	{
-		if (tag->extensionFields.inheritance)
-			eFree ((void *)tag->extensionFields.inheritance);
+		freeTagEntryString (&tag->extensionFields.inheritance);
 		const char *str = opt_string_get_cstr (obj);
 		tag->extensionFields.inheritance = eStrdup (str);
 	}
 	else if (es_object_equal (es_false, obj))
 	{
-		if (tag->extensionFields.inheritance)
-		{
-			eFree ((void *)tag->extensionFields.inheritance);
-			tag->extensionFields.inheritance = NULL;
-		}
+		freeTagEntryString (&tag->extensionFields.inheritance);
 	}
 	else
 		return OPT_ERR_RANGECHECK; /* true is not acceptable. */
@@ -13,10 +13,14 @@
 #include "options_p.h"
 #include "routines.h"
 
+#if defined (HAVE_SYS_SOCKET_H) && defined (HAVE_SYS_UN_H)
+# define INTERACTIVE_SERVER_SUPPORTED
+#endif
 
 struct interactiveModeArgs
 {
 	bool sandbox;
+	char *socketName;	/* the server submode listens on this */
 };
 
 void interactiveLoop (cookedArgs *args, void *user);
@@ -4,7 +4,7 @@
 *   This source code is released for free distribution under the terms of the
 *   GNU General Public License version 2 or (at your option) any later version.
 *
-*   Manages a keyword hash.
+*   Manages the keyword tables of languages.
 */
 
 /*
@@ -12,8 +12,8 @@
 */
 #include "general.h"  /* must always come first */
 
+#include <limits.h>
 #include <string.h>
-#include <ctype.h>
 
 #include "debug.h"
 #include "keyword.h"
@@ -21,94 +21,291 @@
 #include "parse.h"
 #include "routines.h"
 
+/*
+*   MACROS
+*/
+#define MAX_SEED 0x10000
+#define EMPTY_SLOT -1
+
 /*
 *   DATA DECLARATIONS
 */
-typedef struct sHashEntry {
-	struct sHashEntry *next;
+typedef struct sKeywordEntry {
 	const char *string;
-	langType language;
+	unsigned int length;
 	int value;
-} hashEntry;
+
+	/* Hash value of the string folded to lower case */
+	unsigned int hash;
+
+	/* The index of the next entry having the same hash value, or
+	 * EMPTY_SLOT. Keywords equal ignoring case have the same hash value. */
+	int variant;
+} keywordEntry;
+
+/* The keywords of a language. Entries [0, frozen) are copied to the
+ * slots of a perfect hash table; looking up one of them takes a probe
+ * into the table and, usually, one comparison. Entries added after the
+ * table is built are compared one by one until there are enough of them
+ * to rebuild the table.
+ *
+ * The table is a "hash and displace" perfect hash: the hash value of a
+ * keyword selects a bucket, and the seed of the bucket, found when
+ * building the table, is mixed with the hash value to get a slot no
+ * keyword with another hash value occupies. */
+typedef struct sKeywordSet {
+	keywordEntry *entries;
+	unsigned int count;
+	unsigned int allocated;
+	unsigned int maxLength;
+
+	unsigned int frozen;
+	bool failed;
+	keywordEntry *slots;
+	unsigned int slotShift;
+	unsigned int *seeds;
+	unsigned int bucketShift;
+} keywordSet;
 
 /*
 *   DATA DEFINITIONS
 */
-static const unsigned int TableSize = 2039;  /* prime */
-static hashEntry **HashTable = NULL;
-static unsigned int MaxEntryLen = 0;
+static keywordSet **KeywordSets = NULL;
+static unsigned int KeywordSetCount = 0;
 
 /*
 *   FUNCTION DEFINITIONS
 */
 
-static hashEntry **getHashTable (void)
+static keywordSet *getKeywordSet (langType language, bool create)
 {
-	static bool allocated = false;
+	Assert (language >= 0);
 
-	if (! allocated)
+	if ((unsigned int) language >= KeywordSetCount)
 	{
-		unsigned int i;
+		if (! create)
+			return NULL;
+
+		unsigned int count = KeywordSetCount? KeywordSetCount: 64;
+		while (count <= (unsigned int) language)
+			count *= 2;
+		KeywordSets = xRealloc (KeywordSets, count, keywordSet *);
+		for (unsigned int i = KeywordSetCount; i < count; i++)
+			KeywordSets [i] = NULL;
+		KeywordSetCount = count;
+	}
+
+	if (KeywordSets [language] == NULL && create)
+		KeywordSets [language] = xCalloc (1, keywordSet);
+	return KeywordSets [language];
+}
 
-		HashTable = xMalloc (TableSize, hashEntry*);
+/* Like gperf, hash a keyword with its length and a few of its characters
+ * instead of all of them. Keywords having the same hash value share a
+ * slot, and are compared one by one. Setting 0x20 folds ASCII letters to
+ * lower case; it is enough for a hash value which must be the same for
+ * strings equal ignoring case. */
+static unsigned int hashKeyword (const char *const string, size_t length)
+{
+	unsigned int first, middle, last;
 
-		for (i = 0  ;  i < TableSize  ;  ++i)
-			HashTable [i] = NULL;
+	if (length == 0)
+		return 0;
 
-		allocated = true;
-	}
-	return HashTable;
+	first  = (unsigned char) string [0] | 0x20;
+	middle = (unsigned char) string [length / 2] | 0x20;
+	last   = (unsigned char) string [length - 1] | 0x20;
+	return ((unsigned int) length << 24) ^ (first << 16) ^ (middle << 8) ^ last;
 }
 
-static hashEntry *getHashTableEntry (unsigned long hashedValue)
+static unsigned int hashBucket (unsigned int hash, unsigned int shift)
 {
-	hashEntry **const table = getHashTable ();
-	hashEntry *entry;
+	/* Fibonacci hashing; the upper bits are the best mixed. */
+	return (unsigned int) (((unsigned long long) (hash * 0x9e3779b9U)) >> shift);
+}
 
-	Assert (hashedValue < TableSize);
-	entry = table [hashedValue];
+static unsigned int hashSlot (unsigned int hash, unsigned int seed, unsigned int shift)
+{
+	return (unsigned int) (((unsigned long long) ((hash ^ seed) * 0x85ebca6bU)) >> shift);
+}
 
-	return entry;
+static void clearPerfectHash (keywordSet *t)
+{
+	if (t->slots)
+		eFree (t->slots);
+	if (t->seeds)
+		eFree (t->seeds);
+	t->slots = NULL;
+	t->seeds = NULL;
+	t->frozen = 0;
 }
 
-static unsigned int hashValue (const char *const string, langType language,
-	unsigned int maxLen, bool *maxLenReached)
+static bool placeBucket (keywordSet *t, int *slots, const int *heads, unsigned int count,
+						 unsigned int bucket, unsigned int *placed)
 {
-	const char *p;
-	unsigned int h = 5381;
+	for (unsigned int seed = 0; seed < MAX_SEED; seed++)
+	{
+		unsigned int i;
 
-	Assert (string != NULL);
+		for (i = 0; i < count; i++)
+		{
+			unsigned int slot = hashSlot (t->entries [heads [i]].hash, seed, t->slotShift);
+			unsigned int j;
+
+			if (slots [slot] != EMPTY_SLOT)
+				break;
+			for (j = 0; j < i; j++)
+				if (placed [j] == slot)
+					break;
+			if (j < i)
+				break;
+			placed [i] = slot;
+		}
+
+		if (i == count)
+		{
+			for (i = 0; i < count; i++)
+				slots [placed [i]] = heads [i];
+			t->seeds [bucket] = seed;
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool buildPerfectHash (keywordSet *t, unsigned int slotCount)
+{
+	unsigned int n = t->count;
+	unsigned int bucketCount = 1;
+	unsigned int shift = 32;
+
+	/* About four keywords in a bucket */
+	while (bucketCount * 4 < n)
+	{
+		bucketCount *= 2;
+		shift--;
+	}
+	unsigned int *bucketSizes = xCalloc (bucketCount + 1, unsigned int);
+	int *heads = xMalloc (n, int);
+	unsigned int *order = xMalloc (bucketCount, unsigned int);
+	unsigned int *placed = xMalloc (n, unsigned int);
+	int *slots = xMalloc (slotCount, int);
+	bool success = true;
+
+	for (unsigned int i = 0; i < slotCount; i++)
+		slots [i] = EMPTY_SLOT;
+	t->slotShift = 32;
+	for (unsigned int c = slotCount; c > 1; c /= 2)
+		t->slotShift--;
+	t->seeds = xCalloc (bucketCount, unsigned int);
+	t->bucketShift = shift;
+
+	/* Group the entries by bucket. An entry having the same hash value
+	 * as an earlier one doesn't get a slot for itself; it is chained to
+	 * the earlier one instead. */
+	for (unsigned int i = 0; i < n; i++)
+	{
+		t->entries [i].variant = EMPTY_SLOT;
+		bucketSizes [hashBucket (t->entries [i].hash, shift) + 1]++;
+	}
+	for (unsigned int b = 0; b < bucketCount; b++)
+		bucketSizes [b + 1] += bucketSizes [b];
 
-	/* "djb" hash as used in g_str_hash() in glib */
-	for (p = string; *p != '\0'; p++)
+	unsigned int *fill = xMalloc (bucketCount, unsigned int);
+	memcpy (fill, bucketSizes, sizeof (unsigned int) * bucketCount);
+	for (unsigned int i = 0; i < n; i++)
 	{
-		h = (h << 5) + h + (signed char) tolower ((unsigned char) *p);
+		keywordEntry *e = t->entries + i;
+		unsigned int b = hashBucket (e->hash, shift);
+		unsigned int j;
 
-		if (p > string + maxLen)
+		for (j = bucketSizes [b]; j < fill [b]; j++)
 		{
-			*maxLenReached = true;
-			return 0;
+			keywordEntry *head = t->entries + heads [j];
+			if (head->hash == e->hash)
+				break;
 		}
+		if (j < fill [b])
+		{
+			keywordEntry *last = t->entries + heads [j];
+			while (last->variant != EMPTY_SLOT)
+				last = t->entries + last->variant;
+			last->variant = i;
+		}
+		else
+			heads [fill [b]++] = i;
 	}
 
-	/* consider language as an extra "character" and add it to the hash */
-	h = (h << 5) + h + language;
+	/* Place larger buckets first while there are many empty slots. */
+	for (unsigned int b = 0; b < bucketCount; b++)
+	{
+		unsigned int size = fill [b] - bucketSizes [b];
+		unsigned int j = b;
 
-	*maxLenReached = false;
-	return h;
+		while (j > 0 && fill [order [j - 1]] - bucketSizes [order [j - 1]] < size)
+		{
+			order [j] = order [j - 1];
+			j--;
+		}
+		order [j] = b;
+	}
+
+	for (unsigned int k = 0; k < bucketCount && success; k++)
+	{
+		unsigned int b = order [k];
+		success = placeBucket (t, slots, heads + bucketSizes [b], fill [b] - bucketSizes [b],
+							   b, placed);
+	}
+
+	/* Copy the entries to the slots so that a lookup reads the slot only.
+	 * An empty slot has a length no string can have. */
+	if (success)
+	{
+		t->slots = xMalloc (slotCount, keywordEntry);
+		for (unsigned int i = 0; i < slotCount; i++)
+		{
+			if (slots [i] == EMPTY_SLOT)
+			{
+				memset (t->slots + i, 0, sizeof (keywordEntry));
+				t->slots [i].length = UINT_MAX;
+				t->slots [i].variant = EMPTY_SLOT;
+			}
+			else
+				t->slots [i] = t->entries [slots [i]];
+		}
+	}
+
+	eFree (slots);
+	eFree (fill);
+	eFree (placed);
+	eFree (order);
+	eFree (heads);
+	eFree (bucketSizes);
+
+	if (success)
+		t->frozen = n;
+	else
+		clearPerfectHash (t);
+	return success;
 }
 
-static hashEntry *newEntry (
-		const char *const string, langType language, int value)
+static void rebuildPerfectHash (keywordSet *t)
 {
-	hashEntry *const entry = xMalloc (1, hashEntry);
+	unsigned int slotCount = 8;
 
-	entry->next     = NULL;
-	entry->string   = string;
-	entry->language = language;
-	entry->value    = value;
+	while (slotCount < 2 * t->count)
+		slotCount *= 2;
+
+	clearPerfectHash (t);
+	for (int retry = 0; retry < 4; retry++, slotCount *= 2)
+	{
+		if (buildPerfectHash (t, slotCount))
+			return;
+	}
 
-	return entry;
+	/* Never happens unless two keywords have the same hash values.
+	 * All the entries are compared one by one. */
+	t->failed = true;
 }
 
 /*  Note that it is assumed that a "value" of zero means an undefined keyword
@@ -118,65 +315,90 @@ static hashEntry *newEntry (
  */
 extern void addKeyword (const char *const string, langType language, int value)
 {
-	bool dummy;
-	const unsigned int index = hashValue (string, language, 1000, &dummy) % TableSize;
-	hashEntry *entry = getHashTableEntry (index);
-	size_t len = strlen (string);
+	keywordSet *t = getKeywordSet (language, true);
+	keywordEntry *e;
+	size_t length = strlen (string);
 
-	if (len > MaxEntryLen)
-		MaxEntryLen = len;
-
-	if (entry == NULL)
+#ifdef DEBUG
+	for (unsigned int i = 0; i < t->count; i++)
 	{
-		hashEntry **const table = getHashTable ();
-		table [index] = newEntry (string, language, value);
+		if (strcmp (string, t->entries [i].string) == 0)
+			Assert (("Already in table" == NULL));
 	}
-	else
-	{
-		hashEntry *prev = NULL;
+#endif
 
-		while (entry != NULL)
-		{
-			if (language == entry->language  &&
-				strcmp (string, entry->string) == 0)
-			{
-				Assert (("Already in table" == NULL));
-			}
-			prev = entry;
-			entry = entry->next;
-		}
-		if (entry == NULL)
-		{
-			Assert (prev != NULL);
-			prev->next = newEntry (string, language, value);
-		}
+	if (t->count == t->allocated)
+	{
+		t->allocated = t->allocated? t->allocated * 2: 32;
+		t->entries = xRealloc (t->entries, t->allocated, keywordEntry);
 	}
+
+
+	e = t->entries + t->count++;
+	e->string = string;
+	e->length = length;
+	e->value = value;
+	e->hash = hashKeyword (string, length);
+	e->variant = EMPTY_SLOT;
+
+	if (e->length > t->maxLength)
+		t->maxLength = e->length;
+}
+
+static bool matchEntry (const keywordEntry *e, const char *const string,
+						unsigned int length, bool caseSensitive)
+{
+	if (e->length != length)
+		return false;
+	if (caseSensitive)
+		return memcmp (string, e->string, length) == 0;
+	return strncasecmp (string, e->string, length) == 0;
 }
 
 static int lookupKeywordFull (const char *const string, bool caseSensitive, langType language)
 {
-	bool maxLenReached;
-	const unsigned int index = hashValue (string, language, MaxEntryLen, &maxLenReached) % TableSize;
-	hashEntry *entry;
-	int result = KEYWORD_NONE;
+	keywordSet *t = getKeywordSet (language, false);
+	unsigned int hash;
+	size_t length;
 
-	if (maxLenReached)
+	Assert (string != NULL);
+
+	if (t == NULL)
 		return KEYWORD_NONE;
 
-	entry = getHashTableEntry (index);
+	if (! t->failed && t->count - t->frozen > t->frozen / 2 + 4)
+		rebuildPerfectHash (t);
 
-	while (entry != NULL)
+	length = strlen (string);
+	if (length > t->maxLength)
+		return KEYWORD_NONE;
+	hash = hashKeyword (string, length);
+
+	if (t->frozen > 0)
 	{
-		if (language == entry->language &&
-			((caseSensitive && strcmp (string, entry->string) == 0) ||
-			 (!caseSensitive && strcasecmp (string, entry->string) == 0)))
+		unsigned int slot = hashSlot (hash, t->seeds [hashBucket (hash, t->bucketShift)],
+									  t->slotShift);
+		const keywordEntry *e = t->slots + slot;
+
+		if (e->hash == hash)
 		{
-			result = entry->value;
-			break;
+			while (true)
+			{
+				if (matchEntry (e, string, length, caseSensitive))
+					return e->value;
+				if (e->variant == EMPTY_SLOT)
+					break;
+				e = t->entries + e->variant;
+			}
 		}
-		entry = entry->next;
 	}
-	return result;
+
+	for (unsigned int i = t->frozen; i < t->count; i++)
+	{
+		if (matchEntry (t->entries + i, string, length, caseSensitive))
+			return t->entries [i].value;
+	}
+	return KEYWORD_NONE;
 }
 
 extern int lookupKeyword (const char *const string, langType language)
@@ -191,91 +413,55 @@ extern int lookupCaseKeyword (const char *const string, langType language)
 
 extern void freeKeywordTable (void)
 {
-	if (HashTable != NULL)
+	for (unsigned int i = 0; i < KeywordSetCount; i++)
 	{
-		unsigned int i;
-
-		for (i = 0  ;  i < TableSize  ;  ++i)
-		{
-			hashEntry *entry = HashTable [i];
-
-			while (entry != NULL)
-			{
-				hashEntry *next = entry->next;
-				eFree (entry);
-				entry = next;
-			}
-		}
-		eFree (HashTable);
+		keywordSet *t = KeywordSets [i];
+
+		if (t == NULL)
+			continue;
+		clearPerfectHash (t);
+		if (t->entries)
+			eFree (t->entries);
+		eFree (t);
 	}
+	if (KeywordSets)
+		eFree (KeywordSets);
+	KeywordSets = NULL;
+	KeywordSetCount = 0;
 }
 
 #ifdef DEBUG
 
-static void printEntry (const hashEntry *const entry)
-{
-	printf ("  %-15s %-7s\n", entry->string, getLanguageName (entry->language));
-}
-
-static unsigned int printBucket (const unsigned int i)
-{
-	hashEntry **const table = getHashTable ();
-	hashEntry *entry = table [i];
-	unsigned int measure = 1;
-	bool first = true;
-
-	printf ("%2d:", i);
-	if (entry == NULL)
-		printf ("\n");
-	else while (entry != NULL)
-	{
-		if (! first)
-			printf ("    ");
-		else
-		{
-			printf (" ");
-			first = false;
-		}
-		printEntry (entry);
-		entry = entry->next;
-		measure = 2 * measure;
-	}
-	return measure - 1;
-}
-
 extern void printKeywordTable (void)
 {
-	unsigned long emptyBucketCount = 0;
-	unsigned long measure = 0;
-	unsigned int i;
-
-	for (i = 0  ;  i < TableSize  ;  ++i)
+	for (unsigned int i = 0; i < KeywordSetCount; i++)
 	{
-		const unsigned int pass = printBucket (i);
+		keywordSet *t = KeywordSets [i];
 
-		measure += pass;
-		if (pass == 0)
-			++emptyBucketCount;
-	}
+		if (t == NULL)
+			continue;
 
-	printf ("spread measure = %ld\n", measure);
-	printf ("%ld empty buckets\n", emptyBucketCount);
+		printf ("%-15s %u keywords, %u in %u slots%s\n",
+				getLanguageName (i), t->count, t->frozen,
+				t->slots? 1U << (32 - t->slotShift): 0,
+				t->failed? " (no perfect hash)": "");
+		for (unsigned int j = 0; j < t->count; j++)
+			printf ("  %-15s %d\n", t->entries [j].string, t->entries [j].value);
+	}
 }
 
 #endif
 
 extern void dumpKeywordTable (FILE *fp)
 {
-	unsigned int i;
-	for (i = 0  ;  i < TableSize  ;  ++i)
+	for (unsigned int i = 0; i < KeywordSetCount; i++)
 	{
-		hashEntry **const table = getHashTable ();
-		hashEntry *entry = table [i];
-		while (entry != NULL)
-		{
-			fprintf(fp, "%s	%s\n", entry->string, getLanguageName (entry->language));
-			entry = entry->next;
-		}
+		keywordSet *t = KeywordSets [i];
+
+		if (t == NULL)
+			continue;
+		for (unsigned int j = 0; j < t->count; j++)
+			fprintf(fp, "%s	%s\n", t->entries [j].string, getLanguageName (i));
 	}
 }
 
@@ -30,6 +30,13 @@ static regexCompiledCode compile (struct regexBackend *backend,
 								  int flags);
 static void delete_code (void *code);
 static void set_icase_flag (int *flags);
+static char *extract_literal (struct regexBackend *backend,
+							  const char *const regexp,
+							  int flags);
+static bool extract_first_bytes (struct regexBackend *backend,
+								 const char *const regexp,
+								 int flags,
+								 unsigned char *firstBytes);
 
 /*
 *    DATA DEFINITIONS
@@ -41,6 +48,8 @@ static struct regexBackend defaultRegexBackend = {
 	.compile = compile,
 	.match = match,
 	.delete_code = delete_code,
+	.extract_literal = extract_literal,
+	.extract_first_bytes = extract_first_bytes,
 };
 
 /*
@@ -115,13 +124,45 @@ static regexCompiledCode compile (struct regexBackend *backend,
 }
 
 static int match (struct regexBackend *backend,
-				  void *code, const char *input, size_t size CTAGS_ATTR_UNUSED,
+				  void *code, const char *input, size_t size,
 				  regmatch_t pmatch[BACK_REFERENCE_COUNT])
 {
+#ifdef REG_STARTEND
+	/* Without REG_STARTEND, regexec() computes the length of INPUT
+	 * with strlen() at each call. When matching a pattern repeatedly
+	 * against the rest of a large buffer, that makes matching quadratic. */
+	pmatch [0].rm_so = 0;
+	pmatch [0].rm_eo = size;
+	return regexec ((regex_t *)code, input, BACK_REFERENCE_COUNT, pmatch, REG_STARTEND);
+#else
+	/* INPUT is terminated with '\0' here. See
+	 * doesMultilineRegexNeedTerminatedInput (). */
 	return regexec ((regex_t *)code, input, BACK_REFERENCE_COUNT, pmatch, 0);
+#endif
 }
 
 static void set_icase_flag (int *flags)
 {
 	*flags |= REG_ICASE;
 }
+
+static char *extract_literal (struct regexBackend *backend CTAGS_ATTR_UNUSED,
+							  const char *const regexp,
+							  int flags)
+{
+	return extractRegexLiteral (regexp, (flags & REG_EXTENDED)
+								? REGEX_SYNTAX_EXTENDED
+								: REGEX_SYNTAX_BASIC);
+}
+
+static bool extract_first_bytes (struct regexBackend *backend CTAGS_ATTR_UNUSED,
+								 const char *const regexp,
+								 int flags,
+								 unsigned char *firstBytes)
+{
+	return extractRegexFirstBytes (regexp, (flags & REG_EXTENDED)
+								   ? REGEX_SYNTAX_EXTENDED
+								   : REGEX_SYNTAX_BASIC,
+								   (flags & REG_ICASE),
+								   firstBytes);
+}
@@ -23,10 +23,19 @@
 #endif
 
 #include "lregex_p.h"
+#include "routines.h"
 #include "trashbox.h"
 
 #include <string.h>
 
+/*
+*    DATA DECLARATIONS
+*/
+struct pcre2Code {
+	pcre2_code *code;
+	bool jit;					/* compiled to machine code */
+};
+
 /*
 *    FUNCTION DECLARATIONS
 */
@@ -38,6 +47,13 @@ static regexCompiledCode compile (struct regexBackend *backend,
 								  int flags);
 static void delete_code (void *code);
 static void set_icase_flag (int *flags);
+static char *extract_literal (struct regexBackend *backend,
+							  const char *const regexp,
+							  int flags);
+static bool extract_first_bytes (struct regexBackend *backend,
+								 const char *const regexp,
+								 int flags,
+								 unsigned char *firstBytes);
 
 /*
 *    DATA DEFINITIONS
@@ -49,6 +65,8 @@ static struct regexBackend pcre2RegexBackend = {
 	.compile = compile,
 	.match = match,
 	.delete_code = delete_code,
+	.extract_literal = extract_literal,
+	.extract_first_bytes = extract_first_bytes,
 };
 
 /*
@@ -77,7 +95,10 @@ extern void pcre2_regex_flag_long (const char* const s, const char* const unused
 
 static void delete_code (void *code)
 {
-	pcre2_code_free (code);
+	struct pcre2Code *pcode = code;
+
+	pcre2_code_free (pcode->code);
+	eFree (pcode);
 }
 
 static regexCompiledCode compile (struct regexBackend *backend,
@@ -100,21 +121,49 @@ static regexCompiledCode compile (struct regexBackend *backend,
 			   buffer);
 		return (regexCompiledCode) { .backend = NULL, .code = NULL };
 	}
-	return (regexCompiledCode) { .backend = &pcre2RegexBackend, .code = regex_code };
+
+	struct pcre2Code *pcode = xMalloc (1, struct pcre2Code);
+	pcode->code = regex_code;
+	/* If the library doesn't support JIT, the pattern is interpreted. */
+	pcode->jit = (pcre2_jit_compile (regex_code, PCRE2_JIT_COMPLETE) == 0);
+	return (regexCompiledCode) { .backend = &pcre2RegexBackend, .code = pcode };
 }
 
 static int match (struct regexBackend *backend,
 				  void *code, const char *input, size_t size,
 				  regmatch_t pmatch[BACK_REFERENCE_COUNT])
 {
+	/* Shared by all patterns and input lines */
 	static pcre2_match_data *match_data;
+	static pcre2_match_context *match_context;
+	static pcre2_jit_stack *jit_stack;
 	if (match_data == NULL)
 	{
 		match_data = pcre2_match_data_create (BACK_REFERENCE_COUNT, NULL);
 		DEFAULT_TRASH_BOX (match_data, pcre2_match_data_free);
+
+		match_context = pcre2_match_context_create (NULL);
+		DEFAULT_TRASH_BOX (match_context, pcre2_match_context_free);
+		jit_stack = pcre2_jit_stack_create (32 * 1024, 512 * 1024, NULL);
+		if (jit_stack)
+		{
+			DEFAULT_TRASH_BOX (jit_stack, pcre2_jit_stack_free);
+			pcre2_jit_stack_assign (match_context, NULL, jit_stack);
+		}
 	}
 
-	int rc = pcre2_match (code, (PCRE2_SPTR)input, size,
+	struct pcre2Code *pcode = code;
+	int rc;
+	if (pcode->jit)
+	{
+		rc = pcre2_jit_match (pcode->code, (PCRE2_SPTR)input, size,
+							  0, 0, match_data, match_context);
+		if (rc == PCRE2_ERROR_JIT_STACKLIMIT)
+			rc = pcre2_match (pcode->code, (PCRE2_SPTR)input, size,
+							  0, PCRE2_NO_JIT, match_data, NULL);
+	}
+	else
+		rc = pcre2_match (pcode->code, (PCRE2_SPTR)input, size,
 						  0, 0, match_data, NULL);
 	if (rc > 0)
 	{
@@ -138,3 +187,24 @@ static void set_icase_flag (int *flags)
 {
 	*flags |= PCRE2_CASELESS;
 }
+
+static char *extract_literal (struct regexBackend *backend CTAGS_ATTR_UNUSED,
+							  const char *const regexp,
+							  int flags)
+{
+	if (flags & PCRE2_EXTENDED)
+		return NULL;
+	return extractRegexLiteral (regexp, REGEX_SYNTAX_PCRE2);
+}
+
+static bool extract_first_bytes (struct regexBackend *backend CTAGS_ATTR_UNUSED,
+								 const char *const regexp,
+								 int flags,
+								 unsigned char *firstBytes)
+{
+	if (flags & PCRE2_EXTENDED)
+		return false;
+	return extractRegexFirstBytes (regexp, REGEX_SYNTAX_PCRE2,
+								   (flags & PCRE2_CASELESS),
+								   firstBytes);
+}
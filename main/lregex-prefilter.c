@@ -0,0 +1,955 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for prefiltering regular expression
+*   patterns with the literal strings the patterns require.
+*
+*   When a pattern is compiled, the longest literal string that every
+*   match of the pattern must contain is extracted from its source.
+*   The literals of all the single-line patterns of a parser are
+*   combined into one Aho-Corasick automaton. An input line is scanned
+*   once with the automaton, and a pattern is passed to its regex
+*   backend only if its literal occurs in the line.
+*
+*   The extraction is conservative: when it meets a construct it
+*   doesn't understand, it gives up, and the pattern is always
+*   passed to the backend. Literals are folded to lower case so that
+*   one automaton serves both case-sensitive and case-insensitive
+*   patterns.
+*
+*   The patterns of a multitable parser are matched at the input
+*   cursor. For each pattern anchored with '^', the set of bytes its
+*   match can start with is computed. The patterns of a regex table
+*   are compiled into a dispatch table mapping the byte at the cursor
+*   to the patterns worth passing to the backend.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <ctype.h>
+#include <string.h>
+
+#include "debug.h"
+#include "lregex_p.h"
+#include "ptrarray.h"
+#include "routines.h"
+#include "vstring.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+enum quantifier {
+	QUANTIFIER_NONE,
+	QUANTIFIER_PLUS,			/* the atom appears one or more times */
+	QUANTIFIER_OPTIONAL,		/* the atom may not appear */
+};
+
+struct regexDispatch {
+	unsigned int count;			/* number of patterns */
+	unsigned int allocated;
+	unsigned char *firstBytes;	/* count * REGEX_BYTE_SET_SIZE */
+	unsigned char *unknown;		/* patterns whose first bytes are unknown */
+
+	/* Built in regexDispatchCompile () */
+	unsigned short classOf [257];	/* a byte, or 256 for the end of input */
+	unsigned int rowSize;
+	unsigned char *rows;		/* candidate patterns of each class */
+};
+
+struct regexPrefilter {
+	ptrArray *literals;
+
+	/* The automaton; built in regexPrefilterCompile () */
+	unsigned char classOf [256];
+	unsigned int classCount;
+	unsigned int stateCount;
+	int *delta;					/* stateCount * classCount */
+	int *output;				/* literal ending at the state, or -1 */
+	int *dict;					/* next state having output on the suffix chain, or -1 */
+
+	unsigned int *stamp;		/* generation in which the literal is seen last */
+	unsigned int generation;
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static unsigned char foldByte (unsigned char c)
+{
+	return (c >= 'A' && c <= 'Z')? c - 'A' + 'a': c;
+}
+
+static const char *skipBracket (const char *p, enum regexSyntax syntax)
+{
+	Assert (*p == '[');
+
+	p++;
+	if (*p == '^')
+		p++;
+	if (*p == ']')
+		p++;
+
+	while (*p && *p != ']')
+	{
+		if (*p == '[' && p [1] == ':')
+		{
+			const char *q = p + 2;
+			while (isalpha ((unsigned char) *q))
+				q++;
+			if (q [0] != ':' || q [1] != ']')
+				return NULL;
+			p = q + 2;
+		}
+		else if (*p == '[' && (p [1] == '=' || p [1] == '.'))
+		{
+			if (p [2] == '\0' || p [3] != p [1] || p [4] != ']')
+				return NULL;
+			p += 5;
+		}
+		else if (syntax == REGEX_SYNTAX_PCRE2 && *p == '\\' && p [1])
+			p += 2;
+		else
+			p++;
+	}
+	return *p? p + 1: NULL;
+}
+
+/* P points the character just after the opening parenthesis. */
+static const char *skipGroup (const char *p, enum regexSyntax syntax)
+{
+	int depth = 1;
+
+	while (*p)
+	{
+		if (*p == '[')
+		{
+			p = skipBracket (p, syntax);
+			if (p == NULL)
+				return NULL;
+			continue;
+		}
+
+		if (*p == '\\')
+		{
+			if (p [1] == '\0')
+				return NULL;
+			if (syntax == REGEX_SYNTAX_BASIC && p [1] == '(')
+				depth++;
+			else if (syntax == REGEX_SYNTAX_BASIC && p [1] == ')')
+			{
+				if (--depth == 0)
+					return p + 2;
+			}
+			p += 2;
+			continue;
+		}
+
+		if (syntax != REGEX_SYNTAX_BASIC && *p == '(')
+			depth++;
+		else if (syntax != REGEX_SYNTAX_BASIC && *p == ')')
+		{
+			if (--depth == 0)
+				return p + 1;
+		}
+		p++;
+	}
+	return NULL;
+}
+
+/* P points the character just after the opening brace of an interval.
+ * Return the position after CLOSE if an interval like "N", "N,", ",M",
+ * or "N,M" is at P. Otherwise, return NULL; the brace may be a literal. */
+static const char *skipInterval (const char *p, const char *close)
+{
+	const char *start = p;
+
+	while (isdigit ((unsigned char) *p))
+		p++;
+	if (*p == ',')
+		p++;
+	while (isdigit ((unsigned char) *p))
+		p++;
+	if (p == start || strncmp (p, close, strlen (close)) != 0)
+		return NULL;
+	return p + strlen (close);
+}
+
+static enum quantifier skipQuantifiers (const char **pp, enum regexSyntax syntax)
+{
+	enum quantifier q = QUANTIFIER_NONE;
+	const char *p = *pp;
+	const char *end;
+
+	while (true)
+	{
+		if (*p == '*')
+		{
+			q = QUANTIFIER_OPTIONAL;
+			p++;
+		}
+		else if (syntax != REGEX_SYNTAX_BASIC && (*p == '+' || *p == '?'))
+		{
+			if (*p == '?')
+				q = QUANTIFIER_OPTIONAL;
+			else if (q == QUANTIFIER_NONE)
+				q = QUANTIFIER_PLUS;
+			p++;
+		}
+		else if (syntax != REGEX_SYNTAX_BASIC && *p == '{'
+				 && (end = skipInterval (p + 1, "}")))
+		{
+			/* {0,N} makes the atom optional. We don't look into
+			 * the interval; any interval is handled as optional. */
+			q = QUANTIFIER_OPTIONAL;
+			p = end;
+		}
+		else if (syntax == REGEX_SYNTAX_BASIC && *p == '\\'
+				 && (p [1] == '+' || p [1] == '?'))
+		{
+			if (p [1] == '?')
+				q = QUANTIFIER_OPTIONAL;
+			else if (q == QUANTIFIER_NONE)
+				q = QUANTIFIER_PLUS;
+			p += 2;
+		}
+		else if (syntax == REGEX_SYNTAX_BASIC && *p == '\\' && p [1] == '{'
+				 && (end = skipInterval (p + 2, "\\}")))
+		{
+			q = QUANTIFIER_OPTIONAL;
+			p = end;
+		}
+		else
+			break;
+	}
+
+	*pp = p;
+	return q;
+}
+
+static void flushLiteral (vString *run, vString *best)
+{
+	if (vStringLength (run) > vStringLength (best))
+		vStringCopy (best, run);
+	vStringClear (run);
+}
+
+extern char *extractRegexLiteral (const char *regexp, enum regexSyntax syntax)
+{
+	vString *best = vStringNew ();
+	vString *run = vStringNew ();
+	const char *p = regexp;
+	bool failed = false;
+
+	while (*p && !failed)
+	{
+		/* The literal byte of the atom at P, or -1 if the atom is not
+		 * a literal byte. */
+		int c = -1;
+
+		switch (*p)
+		{
+			case '\\':
+			{
+				const unsigned char e = p [1];
+				if (e == '\0' || e == '|' || e >= 0x80)
+					failed = true;
+				else if (syntax == REGEX_SYNTAX_BASIC && e == '(')
+				{
+					p = skipGroup (p + 2, syntax);
+					failed = (p == NULL);
+				}
+				else if (syntax == REGEX_SYNTAX_BASIC && strchr (")}{+?", e))
+					failed = true;
+				else if (isalnum (e))
+				{
+					const char *known = (syntax == REGEX_SYNTAX_PCRE2)
+						? "dDwWsSbBhHvVAzZG"
+						: "wWsSbB123456789";
+					if (strchr (known, e))
+						p += 2;
+					else
+						failed = true;
+				}
+				else if (syntax != REGEX_SYNTAX_PCRE2 && strchr ("<>`'", e))
+					p += 2;
+				else
+				{
+					c = e;
+					p += 2;
+				}
+				break;
+			}
+			case '[':
+				p = skipBracket (p, syntax);
+				failed = (p == NULL);
+				break;
+			case '(':
+				if (syntax == REGEX_SYNTAX_BASIC)
+					c = *p++;
+				else if (syntax == REGEX_SYNTAX_PCRE2
+						 && (p [1] == '*' || (p [1] == '?' && p [2] != ':')))
+					failed = true;
+				else
+				{
+					p = skipGroup (p + 1, syntax);
+					failed = (p == NULL);
+				}
+				break;
+			case ')':
+			case '|':
+				if (syntax == REGEX_SYNTAX_BASIC)
+					c = *p++;
+				else
+					failed = true;
+				break;
+			case '+':
+			case '?':
+			case '{':
+				if (syntax == REGEX_SYNTAX_BASIC)
+					c = *p++;
+				else
+					p++;
+				break;
+			case '.':
+			case '^':
+			case '$':
+			case '*':
+				p++;
+				break;
+			default:
+				if ((unsigned char) *p >= 0x80)
+					p++;
+				else
+					c = *p++;
+				break;
+		}
+
+		if (failed)
+			break;
+
+		enum quantifier q = skipQuantifiers (&p, syntax);
+		if (c >= 0 && q != QUANTIFIER_OPTIONAL)
+			vStringPut (run, foldByte ((unsigned char) c));
+		if (c < 0 || q != QUANTIFIER_NONE)
+			flushLiteral (run, best);
+	}
+
+	flushLiteral (run, best);
+	vStringDelete (run);
+
+	if (failed || vStringLength (best) == 0)
+	{
+		vStringDelete (best);
+		return NULL;
+	}
+	return vStringDeleteUnwrap (best);
+}
+
+extern struct regexPrefilter *regexPrefilterNew (void)
+{
+	struct regexPrefilter *pf = xCalloc (1, struct regexPrefilter);
+	pf->literals = ptrArrayNew (eFree);
+	return pf;
+}
+
+extern void regexPrefilterDelete (struct regexPrefilter *pf)
+{
+	ptrArrayDelete (pf->literals);
+	if (pf->delta)
+		eFree (pf->delta);
+	if (pf->output)
+		eFree (pf->output);
+	if (pf->dict)
+		eFree (pf->dict);
+	if (pf->stamp)
+		eFree (pf->stamp);
+	eFree (pf);
+}
+
+extern int regexPrefilterAddLiteral (struct regexPrefilter *pf, const char *literal)
+{
+	Assert (pf->delta == NULL);
+
+	for (unsigned int i = 0; i < ptrArrayCount (pf->literals); i++)
+	{
+		if (strcmp (ptrArrayItem (pf->literals, i), literal) == 0)
+			return (int) i;
+	}
+	return (int) ptrArrayAdd (pf->literals, eStrdup (literal));
+}
+
+extern unsigned int regexPrefilterCountLiterals (const struct regexPrefilter *pf)
+{
+	return ptrArrayCount (pf->literals);
+}
+
+static int newState (struct regexPrefilter *pf, unsigned int *allocated)
+{
+	if (pf->stateCount == *allocated)
+	{
+		*allocated *= 2;
+		pf->delta = xRealloc (pf->delta, (*allocated) * pf->classCount, int);
+		pf->output = xRealloc (pf->output, *allocated, int);
+		pf->dict = xRealloc (pf->dict, *allocated, int);
+	}
+
+	unsigned int s = pf->stateCount++;
+	for (unsigned int a = 0; a < pf->classCount; a++)
+		pf->delta [s * pf->classCount + a] = -1;
+	pf->output [s] = -1;
+	pf->dict [s] = -1;
+	return (int) s;
+}
+
+extern void regexPrefilterCompile (struct regexPrefilter *pf)
+{
+	unsigned int count = ptrArrayCount (pf->literals);
+
+	Assert (pf->delta == NULL);
+
+	/* Class 0 stands for the bytes not appearing in any literal. */
+	memset (pf->classOf, 0, sizeof (pf->classOf));
+	pf->classCount = 1;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		for (const unsigned char *l = ptrArrayItem (pf->literals, i); *l; l++)
+		{
+			if (pf->classOf [*l] == 0)
+				pf->classOf [*l] = (unsigned char) pf->classCount++;
+		}
+	}
+	for (unsigned int b = 'A'; b <= 'Z'; b++)
+		pf->classOf [b] = pf->classOf [foldByte (b)];
+
+	/* Build the trie. */
+	unsigned int allocated = 16;
+	pf->delta = xMalloc (allocated * pf->classCount, int);
+	pf->output = xMalloc (allocated, int);
+	pf->dict = xMalloc (allocated, int);
+	pf->stateCount = 0;
+	newState (pf, &allocated);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		int s = 0;
+		for (const unsigned char *l = ptrArrayItem (pf->literals, i); *l; l++)
+		{
+			unsigned int a = pf->classOf [*l];
+			if (pf->delta [s * pf->classCount + a] < 0)
+			{
+				int t = newState (pf, &allocated);
+				pf->delta [s * pf->classCount + a] = t;
+			}
+			s = pf->delta [s * pf->classCount + a];
+		}
+		pf->output [s] = (int) i;
+	}
+
+	/* Fill the failure transitions in breadth-first order. */
+	int *fail = xMalloc (pf->stateCount, int);
+	int *queue = xMalloc (pf->stateCount, int);
+	unsigned int head = 0, tail = 0;
+
+	fail [0] = 0;
+	queue [tail++] = 0;
+	while (head < tail)
+	{
+		int s = queue [head++];
+		for (unsigned int a = 0; a < pf->classCount; a++)
+		{
+			int *d = pf->delta + s * pf->classCount + a;
+			if (*d < 0)
+			{
+				*d = (s == 0)? 0: pf->delta [fail [s] * pf->classCount + a];
+				continue;
+			}
+
+			int t = *d;
+			fail [t] = (s == 0)? 0: pf->delta [fail [s] * pf->classCount + a];
+			pf->dict [t] = (pf->output [fail [t]] >= 0)? fail [t]: pf->dict [fail [t]];
+			queue [tail++] = t;
+		}
+	}
+	eFree (queue);
+	eFree (fail);
+
+	pf->stamp = xCalloc (count? count: 1, unsigned int);
+	pf->generation = 0;
+}
+
+extern void regexPrefilterScan (struct regexPrefilter *pf, const char *input, size_t size)
+{
+	Assert (pf->delta);
+
+	if (++pf->generation == 0)
+	{
+		memset (pf->stamp, 0, sizeof (*pf->stamp) * ptrArrayCount (pf->literals));
+		pf->generation = 1;
+	}
+
+	const unsigned char *p = (const unsigned char *) input;
+	const unsigned char *end = p + size;
+	int s = 0;
+	for (; p < end; p++)
+	{
+		s = pf->delta [s * pf->classCount + pf->classOf [*p]];
+
+		/* When the literal of a state is already marked, the literals
+		 * on its suffix chain are marked, too. */
+		for (int t = (pf->output [s] >= 0)? s: pf->dict [s]; t >= 0; t = pf->dict [t])
+		{
+			int l = pf->output [t];
+			if (pf->stamp [l] == pf->generation)
+				break;
+			pf->stamp [l] = pf->generation;
+		}
+	}
+}
+
+extern bool regexPrefilterHasSeen (const struct regexPrefilter *pf, int literal)
+{
+	Assert (literal >= 0 && (unsigned int) literal < ptrArrayCount (pf->literals));
+	return pf->stamp [literal] == pf->generation;
+}
+
+/*
+ * The first bytes of a pattern
+ */
+
+static void addByte (unsigned char *set, unsigned int c)
+{
+	set [c / 8] |= (unsigned char) (1U << (c % 8));
+}
+
+static bool hasByte (const unsigned char *set, unsigned int c)
+{
+	return (set [c / 8] & (1U << (c % 8))) != 0;
+}
+
+static void addBytes (unsigned char *set, const unsigned char *other)
+{
+	for (unsigned int i = 0; i < REGEX_BYTE_SET_SIZE; i++)
+		set [i] |= other [i];
+}
+
+static int isWordByte (int c)
+{
+	return isalnum (c) || c == '_';
+}
+
+/* ctags doesn't call setlocale(); the backends see bytes in the "C"
+ * locale, and the classes have no member above 0x7f. */
+static void addClass (unsigned char *set, int (* isclass) (int), bool negated)
+{
+	for (unsigned int c = 0; c < 256; c++)
+	{
+		if ((c < 0x80 && isclass ((int) c)) != negated)
+			addByte (set, c);
+	}
+}
+
+static bool getEscapedClass (unsigned char e, enum regexSyntax syntax,
+							 int (** isclass) (int), bool *negated)
+{
+	*negated = isupper (e);
+	switch (tolower (e))
+	{
+		case 'd':
+			if (syntax != REGEX_SYNTAX_PCRE2)
+				return false;
+			*isclass = isdigit;
+			return true;
+		case 'w':
+			*isclass = isWordByte;
+			return true;
+		case 's':
+			*isclass = isspace;
+			return true;
+		default:
+			return false;
+	}
+}
+
+static bool isZeroWidthEscape (unsigned char e, enum regexSyntax syntax)
+{
+	return strchr ((syntax == REGEX_SYNTAX_PCRE2)? "bBAzZG": "bB<>`'", e) != NULL;
+}
+
+static const char *firstBytesOfBracket (const char *p, enum regexSyntax syntax,
+										unsigned char *set)
+{
+	static const struct {
+		const char *name;
+		int (* isclass) (int);
+	} classes [] = {
+		{ "alnum", isalnum }, { "alpha", isalpha }, { "blank", isblank },
+		{ "cntrl", iscntrl }, { "digit", isdigit }, { "graph", isgraph },
+		{ "lower", islower }, { "print", isprint }, { "punct", ispunct },
+		{ "space", isspace }, { "upper", isupper }, { "xdigit", isxdigit },
+	};
+	unsigned char members [REGEX_BYTE_SET_SIZE];
+	bool negated = false;
+
+	Assert (*p == '[');
+
+	memset (members, 0, sizeof (members));
+	p++;
+	if (*p == '^')
+	{
+		negated = true;
+		p++;
+	}
+
+	for (bool first = true; *p && (first || *p != ']'); first = false)
+	{
+		unsigned int lo, hi;
+		int (* isclass) (int);
+		bool negatedClass;
+
+		if (*p == '[' && p [1] == ':')
+		{
+			const char *name = p + 2;
+			const char *q = name;
+			while (isalpha ((unsigned char) *q))
+				q++;
+			if (q [0] != ':' || q [1] != ']')
+				return NULL;
+
+			unsigned int i;
+			for (i = 0; i < ARRAY_SIZE (classes); i++)
+			{
+				if (strlen (classes [i].name) == (size_t) (q - name)
+					&& strncmp (classes [i].name, name, q - name) == 0)
+					break;
+			}
+			if (i == ARRAY_SIZE (classes))
+				return NULL;
+			addClass (members, classes [i].isclass, false);
+			p = q + 2;
+			continue;
+		}
+		else if (*p == '[' && (p [1] == '=' || p [1] == '.'))
+			return NULL;
+		else if (syntax == REGEX_SYNTAX_PCRE2 && *p == '\\')
+		{
+			const unsigned char e = p [1];
+			if (e == '\0')
+				return NULL;
+			p += 2;
+			if (isalnum (e))
+			{
+				if (!getEscapedClass (e, syntax, &isclass, &negatedClass))
+					return NULL;
+				addClass (members, isclass, negatedClass);
+				continue;
+			}
+			lo = e;
+		}
+		else
+			lo = (unsigned char) *p++;
+
+		hi = lo;
+		if (p [0] == '-' && p [1] != '\0' && p [1] != ']')
+		{
+			p++;
+			if (*p == '[' || (syntax == REGEX_SYNTAX_PCRE2 && *p == '\\'
+							  && (p [1] == '\0' || isalnum ((unsigned char) p [1]))))
+				return NULL;
+			if (syntax == REGEX_SYNTAX_PCRE2 && *p == '\\')
+				p++;
+			hi = (unsigned char) *p++;
+		}
+		for (unsigned int c = lo; c <= hi; c++)
+			addByte (members, c);
+	}
+
+	if (*p != ']')
+		return NULL;
+
+	for (unsigned int c = 0; c < 256; c++)
+	{
+		if (hasByte (members, c) != negated)
+			addByte (set, c);
+	}
+	return p + 1;
+}
+
+static bool isEndOfAlternative (const char *p, enum regexSyntax syntax)
+{
+	if (syntax == REGEX_SYNTAX_BASIC)
+		return p [0] == '\0' || (p [0] == '\\' && (p [1] == '|' || p [1] == ')'));
+	return p [0] == '\0' || p [0] == '|' || p [0] == ')';
+}
+
+static const char *firstBytesOfAlternatives (const char *p, enum regexSyntax syntax,
+											 bool toplevel,
+											 unsigned char *set, bool *nullable);
+
+/* Compute the bytes the concatenation of the atoms at P can start with.
+ * NULLABLE is set if the concatenation can match the empty string. */
+static const char *firstBytesOfSequence (const char *p, enum regexSyntax syntax,
+										 unsigned char *set, bool *nullable)
+{
+	*nullable = true;
+
+	while (!isEndOfAlternative (p, syntax))
+	{
+		unsigned char atom [REGEX_BYTE_SET_SIZE];
+		bool atomNullable = false;
+		int (* isclass) (int);
+		bool negated;
+
+		memset (atom, 0, sizeof (atom));
+		switch (*p)
+		{
+			case '\\':
+			{
+				const unsigned char e = p [1];
+				if (e == '\0')
+					return NULL;
+				else if (syntax == REGEX_SYNTAX_BASIC && e == '(')
+				{
+					p = firstBytesOfAlternatives (p + 2, syntax, false, atom, &atomNullable);
+					if (p == NULL || p [0] != '\\' || p [1] != ')')
+						return NULL;
+					p += 2;
+				}
+				else if (syntax == REGEX_SYNTAX_BASIC && strchr ("{+?", e))
+					return NULL;
+				else if (isZeroWidthEscape (e, syntax))
+				{
+					atomNullable = true;
+					p += 2;
+				}
+				else if (isalnum (e))
+				{
+					if (!getEscapedClass (e, syntax, &isclass, &negated))
+						return NULL;
+					addClass (atom, isclass, negated);
+					p += 2;
+				}
+				else
+				{
+					addByte (atom, e);
+					p += 2;
+				}
+				break;
+			}
+			case '[':
+				p = firstBytesOfBracket (p, syntax, atom);
+				if (p == NULL)
+					return NULL;
+				break;
+			case '(':
+				if (syntax == REGEX_SYNTAX_BASIC)
+				{
+					addByte (atom, (unsigned char) *p++);
+					break;
+				}
+				else if (syntax == REGEX_SYNTAX_PCRE2 && p [1] == '?' && p [2] == ':')
+					p += 3;
+				else if (syntax == REGEX_SYNTAX_PCRE2 && (p [1] == '?' || p [1] == '*'))
+					return NULL;
+				else
+					p++;
+				p = firstBytesOfAlternatives (p, syntax, false, atom, &atomNullable);
+				if (p == NULL || *p != ')')
+					return NULL;
+				p++;
+				break;
+			case '.':
+				memset (atom, 0xff, sizeof (atom));
+				p++;
+				break;
+			case '$':
+				atomNullable = true;
+				p++;
+				break;
+			case '^':
+			case '*':
+				return NULL;
+			case '+':
+			case '?':
+			case '{':
+				if (syntax != REGEX_SYNTAX_BASIC)
+					return NULL;
+				/* FALLTHROUGH */
+			default:
+				addByte (atom, (unsigned char) *p++);
+				break;
+		}
+
+		if (skipQuantifiers (&p, syntax) == QUANTIFIER_OPTIONAL)
+			atomNullable = true;
+
+		if (*nullable)
+		{
+			addBytes (set, atom);
+			*nullable = atomNullable;
+		}
+	}
+	return p;
+}
+
+/* Compute the bytes the alternatives at P can start with. At the top
+ * level, every alternative must be anchored with '^'.
+ * Return the position of the character terminating the alternatives,
+ * or NULL if the pattern has a construct not handled here. */
+static const char *firstBytesOfAlternatives (const char *p, enum regexSyntax syntax,
+											 bool toplevel,
+											 unsigned char *set, bool *nullable)
+{
+	*nullable = false;
+
+	while (true)
+	{
+		bool n;
+
+		if (toplevel)
+		{
+			if (*p != '^')
+				return NULL;
+			p++;
+		}
+
+		p = firstBytesOfSequence (p, syntax, set, &n);
+		if (p == NULL)
+			return NULL;
+		*nullable = *nullable || n;
+
+		if (syntax == REGEX_SYNTAX_BASIC && p [0] == '\\' && p [1] == '|')
+			p += 2;
+		else if (syntax != REGEX_SYNTAX_BASIC && p [0] == '|')
+			p++;
+		else
+			return p;
+	}
+}
+
+extern bool extractRegexFirstBytes (const char *regexp, enum regexSyntax syntax, bool icase,
+									unsigned char *firstBytes)
+{
+	unsigned char set [REGEX_BYTE_SET_SIZE];
+	bool nullable;
+
+	memset (set, 0, sizeof (set));
+	const char *p = firstBytesOfAlternatives (regexp, syntax, true, set, &nullable);
+	if (p == NULL || *p != '\0' || nullable)
+		return false;
+
+	if (icase)
+	{
+		for (unsigned int c = 'a'; c <= 'z'; c++)
+		{
+			if (hasByte (set, c) || hasByte (set, c - 'a' + 'A'))
+			{
+				addByte (set, c);
+				addByte (set, c - 'a' + 'A');
+			}
+		}
+	}
+
+	memcpy (firstBytes, set, sizeof (set));
+	return true;
+}
+
+/*
+ * Dispatch table
+ */
+
+extern struct regexDispatch *regexDispatchNew (void)
+{
+	return xCalloc (1, struct regexDispatch);
+}
+
+extern void regexDispatchDelete (struct regexDispatch *d)
+{
+	if (d->firstBytes)
+		eFree (d->firstBytes);
+	if (d->unknown)
+		eFree (d->unknown);
+	if (d->rows)
+		eFree (d->rows);
+	eFree (d);
+}
+
+extern void regexDispatchAddPattern (struct regexDispatch *d, const unsigned char *firstBytes)
+{
+	Assert (d->rows == NULL);
+
+	if (d->count == d->allocated)
+	{
+		unsigned int old = d->allocated / 8;
+
+		d->allocated = d->allocated? d->allocated * 2: 16;
+		d->firstBytes = xRealloc (d->firstBytes,
+								  d->allocated * REGEX_BYTE_SET_SIZE, unsigned char);
+		d->unknown = xRealloc (d->unknown, d->allocated / 8, unsigned char);
+		memset (d->unknown + old, 0, d->allocated / 8 - old);
+	}
+
+	unsigned char *set = d->firstBytes + d->count * REGEX_BYTE_SET_SIZE;
+	if (firstBytes)
+		memcpy (set, firstBytes, REGEX_BYTE_SET_SIZE);
+	else
+	{
+		memset (set, 0, REGEX_BYTE_SET_SIZE);
+		addByte (d->unknown, d->count);
+	}
+	d->count++;
+}
+
+extern void regexDispatchCompile (struct regexDispatch *d)
+{
+	Assert (d->rows == NULL);
+
+	d->rowSize = (d->count + 7) / 8;
+	if (d->rowSize == 0)
+		d->rowSize = 1;
+
+	/* The bytes having the same candidates share a row. */
+	unsigned char *row = xCalloc (d->rowSize, unsigned char);
+	unsigned int rowCount = 0;
+	d->rows = xMalloc (257 * d->rowSize, unsigned char);
+
+	for (unsigned int c = 0; c < 257; c++)
+	{
+		memset (row, 0, d->rowSize);
+		for (unsigned int i = 0; i < d->count; i++)
+		{
+			if (hasByte (d->unknown, i)
+				|| (c < 256 && hasByte (d->firstBytes + i * REGEX_BYTE_SET_SIZE, c)))
+				addByte (row, i);
+		}
+
+		unsigned int r;
+		for (r = 0; r < rowCount; r++)
+		{
+			if (memcmp (d->rows + r * d->rowSize, row, d->rowSize) == 0)
+				break;
+		}
+		if (r == rowCount)
+			memcpy (d->rows + rowCount++ * d->rowSize, row, d->rowSize);
+		d->classOf [c] = (unsigned short) r;
+	}
+	eFree (row);
+}
+
+/* C is the byte at the input cursor, or -1 at the end of input. */
+extern const unsigned char *regexDispatchCandidates (const struct regexDispatch *d, int c)
+{
+	Assert (d->rows);
+	return d->rows + d->classOf [(c < 0)? 256: c] * d->rowSize;
+}
+
+extern bool regexDispatchIsCandidate (const unsigned char *candidates, unsigned int index)
+{
+	return hasByte (candidates, index);
+}
@@ -25,6 +25,7 @@
 #endif
 
 #include <inttypes.h>
+#include <time.h>
 
 #include "debug.h"
 #include "colprint_p.h"
@@ -33,7 +34,7 @@
 #include "flags_p.h"
 #include "htable.h"
 #include "kind.h"
-#include "options.h"
+#include "options_p.h"
 #include "optscript.h"
 #include "parse_p.h"
 #include "promise.h"
@@ -189,7 +190,11 @@ typedef struct {
 	struct {
 		unsigned int match;
 		unsigned int unmatch;
+		clock_t elapsed;		/* measured only with --_regex-stats */
 	} statistics;
+
+	/* index of the literal of the pattern in the prefilter, or -1 */
+	int literal;
 } regexTableEntry;
 
 
@@ -197,6 +202,9 @@ typedef struct {
 struct regexTable {
 	char *name;
 	ptrArray *entries;
+
+	/* Built from entries lazily */
+	struct regexDispatch *dispatch;
 };
 
 struct boundaryInRequest {
@@ -226,6 +234,9 @@ struct lregexControlBlock {
 	int currentScope;
 	ptrArray *entries [2];
 
+	/* Built from entries lazily */
+	struct regexPrefilter *prefilter [2];
+
 	ptrArray *tables;
 	ptrArray *tstack;
 
@@ -276,6 +287,8 @@ static void deleteTable (void *ptrn)
 {
 	struct regexTable *t = ptrn;
 
+	if (t->dispatch)
+		regexDispatchDelete (t->dispatch);
 	ptrArrayDelete (t->entries);
 	eFree (t->name);
 	eFree (t);
@@ -297,6 +310,10 @@ static void deletePattern (regexPattern *p)
 		return;
 
 	p->pattern.backend->delete_code (p->pattern.code);
+	if (p->pattern.literal)
+		eFree (p->pattern.literal);
+	if (p->pattern.firstBytes)
+		eFree (p->pattern.firstBytes);
 
 	if (p->type == PTRN_TAG)
 	{
@@ -326,8 +343,29 @@ static void deletePattern (regexPattern *p)
 	eFree (p);
 }
 
+static void invalidatePrefilter (struct lregexControlBlock *lcb,
+								 enum regexParserType regptype)
+{
+	if (lcb->prefilter [regptype])
+	{
+		regexPrefilterDelete (lcb->prefilter [regptype]);
+		lcb->prefilter [regptype] = NULL;
+	}
+}
+
+static void invalidateTableDispatch (struct regexTable *table)
+{
+	if (table->dispatch)
+	{
+		regexDispatchDelete (table->dispatch);
+		table->dispatch = NULL;
+	}
+}
+
 static void clearPatternSet (struct lregexControlBlock *lcb)
 {
+	invalidatePrefilter (lcb, REG_PARSER_SINGLE_LINE);
+	invalidatePrefilter (lcb, REG_PARSER_MULTI_LINE);
 	ptrArrayClear (lcb->entries [REG_PARSER_SINGLE_LINE]);
 	ptrArrayClear (lcb->entries [REG_PARSER_MULTI_LINE]);
 	ptrArrayClear (lcb->tables);
@@ -659,6 +697,8 @@ static regexPattern * newPattern (regexCompiledCode* const pattern,
 
 	ptrn->pattern.backend = pattern->backend;
 	ptrn->pattern.code = pattern->code;
+	ptrn->pattern.literal = pattern->literal;
+	ptrn->pattern.firstBytes = pattern->firstBytes;
 
 	ptrn->exclusive = false;
 	ptrn->accept_empty_name = false;
@@ -689,6 +729,7 @@ static regexTableEntry * newRefPatternEntry (regexTableEntry * other)
 	Assert (other && other->pattern);
 
 	entry->pattern = refPattern(other->pattern);
+	entry->literal = -1;
 	return entry;
 }
 
@@ -697,6 +738,7 @@ static regexTableEntry * newEntry (regexCompiledCode* const pattern,
 {
 	regexTableEntry *entry = xCalloc (1, regexTableEntry);
 	entry->pattern = newPattern (pattern, regptype);
+	entry->literal = -1;
 	return entry;
 }
 
@@ -712,10 +754,14 @@ static regexPattern* addCompiledTagCommon (struct lregexControlBlock *lcb,
 		struct regexTable *table = ptrArrayItem (lcb->tables, table_index);
 		Assert(table);
 
+		invalidateTableDispatch (table);
 		ptrArrayAdd (table->entries, entry);
 	}
 	else
+	{
+		invalidatePrefilter (lcb, regptype);
 		ptrArrayAdd (lcb->entries[regptype], entry);
+	}
 
 	useRegexMethod(lcb->owner);
 
@@ -1519,7 +1565,22 @@ static regexCompiledCode compileRegex (enum regexParserType regptype,
 			   ARRAY_SIZE (backendCommonRegexFlagDefs),
 			   &desc);
 
-	return desc.backend->compile (desc.backend, regexp, desc.flags);
+	regexCompiledCode cp = desc.backend->compile (desc.backend, regexp, desc.flags);
+	if (cp.code && desc.backend->extract_literal)
+		cp.literal = desc.backend->extract_literal (desc.backend, regexp, desc.flags);
+	/* Only multitable patterns are matched at the start of the input;
+	 * '^' of the others may match after a newline. */
+	if (cp.code && regptype == REG_PARSER_MULTI_TABLE
+		&& desc.backend->extract_first_bytes)
+	{
+		unsigned char firstBytes [REGEX_BYTE_SET_SIZE];
+		if (desc.backend->extract_first_bytes (desc.backend, regexp, desc.flags, firstBytes))
+		{
+			cp.firstBytes = xMalloc (REGEX_BYTE_SET_SIZE, unsigned char);
+			memcpy (cp.firstBytes, firstBytes, REGEX_BYTE_SET_SIZE);
+		}
+	}
+	return cp;
 }
 
 
@@ -1916,6 +1977,23 @@ static bool fillGuestRequest (const char *start,
 	return guestRequestIsFilled (guest_req);
 }
 
+static int matchBackend (regexTableEntry *entry,
+						 const char *input, size_t size,
+						 regmatch_t pmatch [BACK_REFERENCE_COUNT])
+{
+	regexCompiledCode *pattern = &entry->pattern->pattern;
+
+	if (!Option.regexStats)
+		return pattern->backend->match (pattern->backend, pattern->code,
+										input, size, pmatch);
+
+	clock_t start = clock ();
+	int match = pattern->backend->match (pattern->backend, pattern->code,
+										 input, size, pmatch);
+	entry->statistics.elapsed += clock () - start;
+	return match;
+}
+
 static bool matchRegexPattern (struct lregexControlBlock *lcb,
 							   const vString* const line,
 							   regexTableEntry *entry)
@@ -1929,10 +2007,7 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 	if (patbuf->disabled && *(patbuf->disabled))
 		return false;
 
-	match = patbuf->pattern.backend->match (patbuf->pattern.backend,
-											patbuf->pattern.code, vStringValue (line),
-											vStringLength (line),
-											pmatch);
+	match = matchBackend (entry, vStringValue (line), vStringLength (line), pmatch);
 
 	if (match == 0)
 	{
@@ -1994,7 +2069,7 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 }
 
 static bool matchMultilineRegexPattern (struct lregexControlBlock *lcb,
-										const vString* const allLines,
+										const char *const input, const size_t length,
 										regexTableEntry *entry)
 {
 	const char *start;
@@ -2013,13 +2088,12 @@ static bool matchMultilineRegexPattern (struct lregexControlBlock *lcb,
 	if (patbuf->disabled && *(patbuf->disabled))
 		return false;
 
-	current = start = vStringValue (allLines);
+	current = start = input;
 	do
 	{
-		match = patbuf->pattern.backend->match (patbuf->pattern.backend,
-												patbuf->pattern.code, current,
-												vStringLength (allLines) - (current - start),
-												pmatch);
+		match = matchBackend (entry, current,
+							  length - (current - start),
+							  pmatch);
 
 		if (match != 0)
 		{
@@ -2092,11 +2166,57 @@ static bool matchMultilineRegexPattern (struct lregexControlBlock *lcb,
 		}
 		current += delta;
 
-	} while (current < start + vStringLength (allLines));
+	} while (current < start + length);
 
 	return result;
 }
 
+static struct regexPrefilter *buildPrefilter (ptrArray *entries)
+{
+	struct regexPrefilter *pf = regexPrefilterNew ();
+
+	for (unsigned int i = 0; i < ptrArrayCount (entries); i++)
+	{
+		regexTableEntry *entry = ptrArrayItem (entries, i);
+		const char *literal = entry->pattern->pattern.literal;
+
+		entry->literal = literal? regexPrefilterAddLiteral (pf, literal): -1;
+	}
+	regexPrefilterCompile (pf);
+	return pf;
+}
+
+/* Scan INPUT with the literals of the patterns of REGPTYPE.
+ * Return NULL if none of the patterns has a literal. */
+static struct regexPrefilter *prefilterInput (struct lregexControlBlock *lcb,
+											  enum regexParserType regptype,
+											  const char *const input, const size_t length)
+{
+	if (lcb->prefilter [regptype] == NULL)
+		lcb->prefilter [regptype] = buildPrefilter (lcb->entries [regptype]);
+
+	struct regexPrefilter *pf = lcb->prefilter [regptype];
+	if (regexPrefilterCountLiterals (pf) == 0)
+		return NULL;
+
+	regexPrefilterScan (pf, input, length);
+	return pf;
+}
+
+/* Skip the patterns whose literals don't appear in the input;
+ * they never match. */
+static bool isPrefilteredOut (struct regexPrefilter *pf, regexTableEntry *entry)
+{
+	if (pf == NULL || entry->literal < 0
+		|| regexPrefilterHasSeen (pf, entry->literal))
+		return false;
+
+	regexPattern *ptrn = entry->pattern;
+	if (!(ptrn->disabled && *(ptrn->disabled)))
+		entry->statistics.unmatch++;
+	return true;
+}
+
 /* PUBLIC INTERFACE */
 
 /* Match against all patterns for specified language. Returns true if at least
@@ -2106,6 +2226,10 @@ extern bool matchRegex (struct lregexControlBlock *lcb, const vString* const lin
 {
 	bool result = false;
 	unsigned int i;
+
+	struct regexPrefilter *pf = prefilterInput (lcb, REG_PARSER_SINGLE_LINE,
+												vStringValue (line), vStringLength (line));
+
 	for (i = 0  ;  i < ptrArrayCount(lcb->entries[REG_PARSER_SINGLE_LINE])  ;  ++i)
 	{
 		regexTableEntry *entry = ptrArrayItem(lcb->entries[REG_PARSER_SINGLE_LINE], i);
@@ -2117,6 +2241,9 @@ extern bool matchRegex (struct lregexControlBlock *lcb, const vString* const lin
 			&& (!isXtagEnabled (ptrn->xtagType)))
 				continue;
 
+		if (isPrefilteredOut (pf, entry))
+			continue;
+
 		if (matchRegexPattern (lcb, line, entry))
 		{
 			result = true;
@@ -2602,6 +2729,7 @@ extern void freeRegexResources (void)
 {
 	es_object_unref (lregex_dict);
 	opt_vm_delete (optvm);
+	opt_fin ();
 }
 
 extern bool regexNeedsMultilineBuffer (struct lregexControlBlock *lcb)
@@ -2614,12 +2742,33 @@ extern bool regexNeedsMultilineBuffer (struct lregexControlBlock *lcb)
 		return false;
 }
 
-extern bool matchMultilineRegex (struct lregexControlBlock *lcb, const vString* const allLines)
+/* Without REG_STARTEND, the default backend ignores the length of the
+ * input and matches up to the terminating '\0'. The multiline patterns
+ * must then be matched on a copy of the input. */
+extern bool doesMultilineRegexNeedTerminatedInput (void)
+{
+#ifdef REG_STARTEND
+	return false;
+#else
+	return true;
+#endif
+}
+
+extern bool regexHasLinePatterns (struct lregexControlBlock *lcb)
+{
+	return ptrArrayCount(lcb->entries [REG_PARSER_SINGLE_LINE]) > 0;
+}
+
+extern bool matchMultilineRegex (struct lregexControlBlock *lcb,
+								 const char *const input, const size_t length)
 {
 	bool result = false;
 
 	unsigned int i;
 
+	/* One pass over the whole input for all the patterns */
+	struct regexPrefilter *pf = prefilterInput (lcb, REG_PARSER_MULTI_LINE, input, length);
+
 	for (i = 0; i < ptrArrayCount(lcb->entries [REG_PARSER_MULTI_LINE]); ++i)
 	{
 		regexTableEntry *entry = ptrArrayItem(lcb->entries [REG_PARSER_MULTI_LINE], i);
@@ -2629,7 +2778,10 @@ extern bool matchMultilineRegex (struct lregexControlBlock *lcb, const vString*
 			&& (!isXtagEnabled (entry->pattern->xtagType)))
 			continue;
 
-		result = matchMultilineRegexPattern (lcb, allLines, entry) || result;
+		if (isPrefilteredOut (pf, entry))
+			continue;
+
+		result = matchMultilineRegexPattern (lcb, input, length, entry) || result;
 	}
 	return result;
 }
@@ -2701,14 +2853,15 @@ static void dumpTstack(FILE* fp, ptrArray *tstack)
 	fprintf(fp, "\n");
 }
 
-static void printInputLine(FILE* vfp, const char *c, const off_t offset)
+static void printInputLine(FILE* vfp, const char *c, const char *const end,
+						   const off_t offset)
 {
 	vString *v = vStringNew ();
 
-	for (; *c && (*c != '\n'); c++)
+	for (; c < end && *c && (*c != '\n'); c++)
 		vStringPut(v, *c);
 
-	if (vStringLength (v) == 0 && *c == '\n')
+	if (vStringLength (v) == 0 && c < end && *c == '\n')
 		vStringCatS (v, "\\n");
 
 	fprintf (vfp, "\ninput : \"%s\" L%lu\n",
@@ -2745,33 +2898,59 @@ static void printMultitableMessage(const langType language,
 	vStringDelete (msg);
 }
 
+static struct regexDispatch *getTableDispatch (struct regexTable *table)
+{
+	if (table->dispatch == NULL)
+	{
+		table->dispatch = regexDispatchNew ();
+		for (unsigned int i = 0; i < ptrArrayCount (table->entries); i++)
+		{
+			regexTableEntry *entry = ptrArrayItem (table->entries, i);
+			regexDispatchAddPattern (table->dispatch, entry->pattern->pattern.firstBytes);
+		}
+		regexDispatchCompile (table->dispatch);
+	}
+	return table->dispatch;
+}
+
 static struct regexTable * matchMultitableRegexTable (struct lregexControlBlock *lcb,
-													  struct regexTable *table, const vString *const start, unsigned int *offset)
+													  struct regexTable *table,
+													  const char *const input, const size_t length,
+													  unsigned int *offset)
 {
 	struct regexTable *next = NULL;
 	const char *current;
 	regmatch_t pmatch [BACK_REFERENCE_COUNT];
-	const char *cstart = vStringValue(start);
+	const char *cstart = input;
 	unsigned int delta;
+	struct regexDispatch *dispatch = getTableDispatch (table);
+	const unsigned char *candidates;
 
 
  restart:
 	current = cstart + *offset;
 
-	/* Accept the case *offset == vStringLength(start)
-	   because we want an empty regex // still matches empty input. */
-	if (*offset > vStringLength(start))
+	/* Accept the case *offset == length
+	   because we want an empty regex // still matches empty input.
+	   INPUT may not be terminated with '\0'; don't look at *current
+	   in that case. */
+	if (*offset > length)
 	{
-		*offset = vStringLength(start);
+		*offset = length;
 		goto out;
 	}
 
 	BEGIN_VERBOSE(vfp);
 	{
-		printInputLine(vfp, current, *offset);
+		printInputLine(vfp, current, cstart + length, *offset);
 	}
 	END_VERBOSE();
 
+	/* Pass only the patterns that can match the byte at the cursor
+	 * to the backend. */
+	candidates = regexDispatchCandidates (dispatch,
+										  (*offset < length)? (unsigned char) *current: -1);
+
 	for (unsigned int i = 0; i < ptrArrayCount(table->entries); i++)
 	{
 		regexTableEntry *entry = ptrArrayItem(table->entries, i);
@@ -2787,7 +2966,12 @@ static struct regexTable * matchMultitableRegexTable (struct lregexControlBlock
 		BEGIN_VERBOSE(vfp);
 		{
 			char s[3];
-			if (*current == '\n')
+			if (*offset == length)
+			{
+				s [0] = '\0';
+				s [1] = '\0';
+			}
+			else if (*current == '\n')
 			{
 				s [0] = '\\';
 				s [1] = 'n';
@@ -2826,10 +3010,15 @@ static struct regexTable * matchMultitableRegexTable (struct lregexControlBlock
 		if (ptrn->disabled && *(ptrn->disabled))
 			continue;
 
-		match = ptrn->pattern.backend->match (ptrn->pattern.backend,
-											  ptrn->pattern.code, current,
-											  vStringLength(start) - (current - cstart),
-											  pmatch);
+		if (!regexDispatchIsCandidate (candidates, i))
+		{
+			entry->statistics.unmatch++;
+			continue;
+		}
+
+		match = matchBackend (entry, current,
+							  length - (current - cstart),
+							  pmatch);
 		if (match == 0)
 		{
 			entry->statistics.match++;
@@ -3025,6 +3214,7 @@ extern void extendRegexTable (struct lregexControlBlock *lcb, const char *src, c
 		error (FATAL, "no such regex table in %s: %s", getLanguageName(lcb->owner), dist);
 	dist_table = ptrArrayItem(lcb->tables, i);
 
+	invalidateTableDispatch (dist_table);
 	for (unsigned int n = 0; n < ptrArrayCount(src_table->entries); n++)
 	{
 		regexTableEntry *entry = ptrArrayItem (src_table->entries, n);
@@ -3034,6 +3224,21 @@ extern void extendRegexTable (struct lregexControlBlock *lcb, const char *src, c
 
 extern void printMultitableStatistics (struct lregexControlBlock *lcb)
 {
+	if (ptrArrayCount(lcb->entries[REG_PARSER_MULTI_LINE]) > 0)
+	{
+		fprintf(stderr, "\nMLINE REGEX STATISTICS of %s\n", getLanguageName (lcb->owner));
+		fputs("==============================================\n", stderr);
+		for (unsigned int i = 0; i < ptrArrayCount(lcb->entries[REG_PARSER_MULTI_LINE]); i++)
+		{
+			regexTableEntry *entry = ptrArrayItem (lcb->entries[REG_PARSER_MULTI_LINE], i);
+			Assert (entry && entry->pattern);
+			fprintf(stderr, "%10u/%-10u%s\n",
+					entry->statistics.match,
+					entry->statistics.unmatch + entry->statistics.match,
+					entry->pattern->pattern_string);
+		}
+	}
+
 	if (ptrArrayCount(lcb->tables) == 0)
 		return;
 
@@ -3058,7 +3263,46 @@ extern void printMultitableStatistics (struct lregexControlBlock *lcb)
 	}
 }
 
-extern bool matchMultitableRegex (struct lregexControlBlock *lcb, const vString* const allLines)
+static void printRegexStatistics0 (const char *title, ptrArray *entries)
+{
+	if (ptrArrayCount (entries) == 0)
+		return;
+
+	fprintf(stderr, "%s\n", title);
+	fputs("-----------------------\n", stderr);
+	for (unsigned int i = 0; i < ptrArrayCount (entries); i++)
+	{
+		regexTableEntry *entry = ptrArrayItem (entries, i);
+		Assert (entry && entry->pattern);
+		fprintf(stderr, "%10.3fms %10u/%-10u%s\n",
+				(double) entry->statistics.elapsed * 1000 / CLOCKS_PER_SEC,
+				entry->statistics.match,
+				entry->statistics.unmatch + entry->statistics.match,
+				entry->pattern->pattern_string);
+	}
+	fputc('\n', stderr);
+}
+
+extern void printRegexStatistics (struct lregexControlBlock *lcb)
+{
+	if (ptrArrayCount(lcb->entries[REG_PARSER_SINGLE_LINE]) == 0
+		&& ptrArrayCount(lcb->entries[REG_PARSER_MULTI_LINE]) == 0
+		&& ptrArrayCount(lcb->tables) == 0)
+		return;
+
+	fprintf(stderr, "\nREGEX STATISTICS of %s\n", getLanguageName (lcb->owner));
+	fputs("==============================================\n", stderr);
+	printRegexStatistics0 ("(regex)", lcb->entries[REG_PARSER_SINGLE_LINE]);
+	printRegexStatistics0 ("(mline-regex)", lcb->entries[REG_PARSER_MULTI_LINE]);
+	for (unsigned int i = 0; i < ptrArrayCount(lcb->tables); i++)
+	{
+		struct regexTable *table = ptrArrayItem (lcb->tables, i);
+		printRegexStatistics0 (table->name, table->entries);
+	}
+}
+
+extern bool matchMultitableRegex (struct lregexControlBlock *lcb,
+								  const char *const input, const size_t length)
 {
 	if (ptrArrayCount (lcb->tables) == 0)
 		return false;
@@ -3073,7 +3317,7 @@ extern bool matchMultitableRegex (struct lregexControlBlock *lcb, const vString*
 	while (table)
 	{
 		last_offset = offset;
-		table = matchMultitableRegexTable(lcb, table, allLines, &offset);
+		table = matchMultitableRegexTable(lcb, table, input, length, &offset);
 
 		if (last_offset == offset)
 			motionless_counter++;
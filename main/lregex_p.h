@@ -32,6 +32,9 @@
 /* Back-references \0 through \9 */
 #define BACK_REFERENCE_COUNT 10
 
+/* A set of bytes as a bitmap */
+#define REGEX_BYTE_SET_SIZE (256 / 8)
+
 /*
 *   DATA DECLARATIONS
 */
@@ -41,11 +44,28 @@ enum regexParserType {
 	REG_PARSER_MULTI_TABLE,
 };
 
+enum regexSyntax {
+	REGEX_SYNTAX_BASIC,
+	REGEX_SYNTAX_EXTENDED,
+	REGEX_SYNTAX_PCRE2,
+};
+
 struct lregexControlBlock;
+struct regexPrefilter;
+struct regexDispatch;
 
 typedef struct sRegexCompiledCode {
 	struct regexBackend *backend;
 	void * code;
+
+	/* A literal string every match contains, folded to lower case;
+	 * NULL if unknown. */
+	char * literal;
+
+	/* The bytes a match starting at the beginning of the input can
+	 * start with (REGEX_BYTE_SET_SIZE bytes); NULL if unknown.
+	 * Extracted only for multitable patterns. */
+	unsigned char * firstBytes;
 } regexCompiledCode;
 
 struct regexBackend {
@@ -60,6 +80,13 @@ struct regexBackend {
 									   void *, const char *, size_t,
 									   regmatch_t[BACK_REFERENCE_COUNT]);
 	void              (* delete_code) (void *);
+	char *            (* extract_literal) (struct regexBackend *,
+										   const char* const,
+										   int);
+	bool              (* extract_first_bytes) (struct regexBackend *,
+											   const char* const,
+											   int,
+											   unsigned char *);
 };
 
 struct flagDefsDescriptor {
@@ -98,8 +125,11 @@ extern void addCallbackRegex (struct lregexControlBlock *lcb,
 							  bool *disabled,
 							  void * userData);
 extern bool regexNeedsMultilineBuffer (struct lregexControlBlock *lcb);
-extern bool matchMultilineRegex (struct lregexControlBlock *lcb, const vString* const allLines);
-extern bool matchMultitableRegex (struct lregexControlBlock *lcb, const vString* const allLines);
+extern bool regexHasLinePatterns (struct lregexControlBlock *lcb);
+extern bool matchMultilineRegex (struct lregexControlBlock *lcb,
+								 const char *const input, const size_t length);
+extern bool matchMultitableRegex (struct lregexControlBlock *lcb,
+								  const char *const input, const size_t length);
 
 extern void notifyRegexInputStart (struct lregexControlBlock *lcb);
 extern void notifyRegexInputEnd (struct lregexControlBlock *lcb);
@@ -114,6 +144,7 @@ extern void addOptscriptToHook (struct lregexControlBlock *lcb, enum scriptHook
 extern void propagateParamToOptscript (struct lregexControlBlock *lcb, const char *param, const char *value);
 
 extern void printMultitableStatistics (struct lregexControlBlock *lcb);
+extern void printRegexStatistics (struct lregexControlBlock *lcb);
 
 extern void basic_regex_flag_short (char c, void* data);
 extern void basic_regex_flag_long (const char* const s, const char* const unused, void* data);
@@ -124,4 +155,25 @@ extern void pcre2_regex_flag_short (char c, void* data);
 extern void pcre2_regex_flag_long (const char* const s, const char* const unused, void* data);
 #endif
 
+/* lregex-prefilter.c */
+extern char *extractRegexLiteral (const char *regexp, enum regexSyntax syntax);
+
+extern struct regexPrefilter *regexPrefilterNew (void);
+extern void regexPrefilterDelete (struct regexPrefilter *pf);
+extern int  regexPrefilterAddLiteral (struct regexPrefilter *pf, const char *literal);
+extern unsigned int regexPrefilterCountLiterals (const struct regexPrefilter *pf);
+extern void regexPrefilterCompile (struct regexPrefilter *pf);
+extern void regexPrefilterScan (struct regexPrefilter *pf, const char *input, size_t size);
+extern bool regexPrefilterHasSeen (const struct regexPrefilter *pf, int literal);
+
+extern bool extractRegexFirstBytes (const char *regexp, enum regexSyntax syntax, bool icase,
+									unsigned char *firstBytes);
+
+extern struct regexDispatch *regexDispatchNew (void);
+extern void regexDispatchDelete (struct regexDispatch *d);
+extern void regexDispatchAddPattern (struct regexDispatch *d, const unsigned char *firstBytes);
+extern void regexDispatchCompile (struct regexDispatch *d);
+extern const unsigned char *regexDispatchCandidates (const struct regexDispatch *d, int c);
+extern bool regexDispatchIsCandidate (const unsigned char *candidates, unsigned int index);
+
 #endif	/* CTAGS_MAIN_LREGEX_PRIVATEH */
@@ -28,6 +28,7 @@
 #include <crt_externs.h>
 #endif
 
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -48,6 +49,14 @@
 # include <io.h>  /* to declare _findfirst() */
 #endif
 
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>  /* to declare fork() and pipe() */
+#endif
+#ifdef HAVE_SYS_WAIT_H
+# include <sys/wait.h>  /* to declare waitpid() */
+#endif
+#include <signal.h>  /* to declare sigaction() */
+
 
 #include "ctags.h"
 #include "debug.h"
@@ -59,9 +68,14 @@
 #include "options_p.h"
 #include "optscript.h"
 #include "parse_p.h"
+#include "pathmatch_p.h"
+#include "ptrarray.h"
+#include "read.h"
 #include "read_p.h"
 #include "routines_p.h"
 #include "stats_p.h"
+#include "tagcache_p.h"
+#include "tagindex_p.h"
 #include "trace.h"
 #include "trashbox_p.h"
 #include "writer_p.h"
@@ -71,6 +85,11 @@
 #include "interactive_p.h"
 #include <jansson.h>
 #include <errno.h>
+#ifdef INTERACTIVE_SERVER_SUPPORTED
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
 #endif
 
 /*
@@ -79,10 +98,48 @@
 static mainLoopFunc mainLoop;
 static void *mainData;
 
+/*  The exclude files (--exclude-ignore-file) of the directories being
+ *  recursed into, from the outermost.
+ */
+typedef struct sIgnoreFrame {
+	char *dirName;
+	ignoreRules *rules;
+} ignoreFrame;
+static ptrArray *IgnoreFrames;
+
+#ifdef JOBS_SUPPORTED
+/*  With --walk-ahead, a walker process enumerates the directories given
+ *  with --recurse, and passes the names of the files to parse through a
+ *  pipe to this process, which parses them meanwhile. The walker blocks
+ *  when the pipe is full, so it never runs far ahead of the parser. As
+ *  the walker makes the same decisions in the same order as recursing in
+ *  this process, the files are parsed in the same order.
+ */
+static int WalkerOutput = -1;	/* the pipe, in the walker process */
+static char WalkerBuffer [4096];
+static size_t WalkerBuffered;
+
+/*  With --jobs, this process walks the inputs, and passes the files to
+ *  parse to the workers through pipes: the nth file goes to the worker
+ *  whose index is nth modulo count. A worker reads the options given
+ *  between the inputs as this process does, so an empty name ends the
+ *  files of each input.
+ */
+static struct sJobDispatcher {
+	FILE **outputs;		/* the pipes to the workers, in this process */
+	unsigned int count;
+	unsigned long nth;
+	FILE *input;		/* the pipe from this process, in a worker */
+} Job;
+#endif
+
 /*
 *   FUNCTION PROTOTYPES
 */
 static bool createTagsForEntry (const char *const entryName);
+static bool createTagsForEntryWithStatus (const char *const entryName,
+										  fileStatus *status);
+static bool createTagsForFile (const char *const entryName);
 
 /*
 *   FUNCTION DEFINITIONS
@@ -112,7 +169,20 @@ static bool recurseUsingOpendir (const char *const dirName)
 					filePath = combinePathAndFile (dirName, entry->d_name);
 					free_p = true;
 				}
-				resize |= createTagsForEntry (filePath);
+#if defined (DT_DIR) && defined (DT_REG)
+				/* Save a stat() when readdir() tells the type. */
+				if (entry->d_type == DT_DIR || entry->d_type == DT_REG)
+				{
+					fileStatus status = {
+						.exists = true,
+						.isDirectory = (entry->d_type == DT_DIR),
+						.isNormalFile = (entry->d_type == DT_REG),
+					};
+					resize |= createTagsForEntryWithStatus (filePath, &status);
+				}
+				else
+#endif
+					resize |= createTagsForEntry (filePath);
 				if (free_p)
 					eFree (filePath);
 			}
@@ -163,14 +233,243 @@ static bool createTagsForWildcardUsingFindfirst (const char *const pattern)
 #endif
 
 
-static bool recurseIntoDirectory (const char *const dirName)
+static void deleteIgnoreFrame (void *data)
+{
+	ignoreFrame *frame = data;
+
+	ignoreRulesDelete (frame->rules);
+	eFree (frame->dirName);
+	eFree (frame);
+}
+
+static bool pushIgnoreFrame (const char *const dirName)
+{
+	char *fileName = combinePathAndFile (dirName, Option.excludeIgnoreFile);
+	ignoreRules *rules = ignoreRulesNew (fileName);
+
+	eFree (fileName);
+	if (rules == NULL)
+		return false;
+
+	ignoreFrame *frame = xMalloc (1, ignoreFrame);
+	frame->dirName = eStrdup (dirName);
+	frame->rules = rules;
+	if (IgnoreFrames == NULL)
+		IgnoreFrames = ptrArrayNew (deleteIgnoreFrame);
+	ptrArrayAdd (IgnoreFrames, frame);
+	return true;
+}
+
+static void popIgnoreFrame (void)
+{
+	ptrArrayDeleteLast (IgnoreFrames);
+	if (ptrArrayCount (IgnoreFrames) == 0)
+	{
+		ptrArrayDelete (IgnoreFrames);
+		IgnoreFrames = NULL;
+	}
+}
+
+/*  The exclude file of a deeper directory takes precedence.
+ */
+static bool isIgnoredEntry (const char *const entryName, bool isDirectory)
+{
+	for (unsigned int i = ptrArrayCount (IgnoreFrames); i > 0; i--)
+	{
+		const ignoreFrame *frame = ptrArrayItem (IgnoreFrames, i - 1);
+		const char *relPath = entryName;
+
+		if (strcmp (frame->dirName, ".") != 0)
+		{
+			size_t length = strlen (frame->dirName);
+			if (strncmp (entryName, frame->dirName, length) != 0)
+				continue;
+			relPath = entryName + length;
+			if (length > 0 && frame->dirName [length - 1] != PATH_SEPARATOR
+				&& frame->dirName [length - 1] != OUTPUT_PATH_SEPARATOR)
+				relPath++;
+		}
+
+		int r = ignoreRulesMatch (frame->rules, relPath, isDirectory);
+		if (r != 0)
+			return r > 0;
+	}
+	return false;
+}
+
+#ifdef JOBS_SUPPORTED
+static void writeToParser (const char *p, size_t length)
+{
+	while (length > 0)
+	{
+		ssize_t n = write (WalkerOutput, p, length);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			error (FATAL | PERROR, "cannot pass file names to the parser");
+		p += n;
+		length -= n;
+	}
+}
+
+static void flushWalkerBuffer (void)
+{
+	writeToParser (WalkerBuffer, WalkerBuffered);
+	WalkerBuffered = 0;
+}
+
+/*  Pass ENTRYNAME terminated with '\0'.
+ */
+static void passEntryToParser (const char *const entryName)
+{
+	size_t length = strlen (entryName) + 1;
+
+	if (WalkerBuffered + length > sizeof (WalkerBuffer))
+		flushWalkerBuffer ();
+	if (length > sizeof (WalkerBuffer))
+		writeToParser (entryName, length);
+	else
+	{
+		memcpy (WalkerBuffer + WalkerBuffered, entryName, length);
+		WalkerBuffered += length;
+	}
+}
+
+/*  Pass ENTRYNAME that does not exist after an empty name; the parser
+ *  notes it for --update.
+ */
+static void passRemovedEntryToParser (const char *const entryName)
+{
+	passEntryToParser ("");
+	passEntryToParser (entryName);
+}
+
+/*  Run recurseUsingOpendir () in a walker process, and parse the files
+ *  it passes.
+ */
+static bool recurseUsingWalker (const char *const dirName)
+{
+	bool resize = false;
+	int p[2];
+	pid_t pid;
+	int status;
+
+	if (pipe (p) == -1)
+		error (FATAL | PERROR, "cannot create a pipe for walking \"%s\"", dirName);
+
+	/* Nothing buffered must be written twice. */
+	flushTagFile ();
+	fflush (stdout);
+	fflush (stderr);
+
+	pid = fork ();
+	if (pid == -1)
+		error (FATAL | PERROR, "cannot fork a process walking \"%s\"", dirName);
+	else if (pid == 0)
+	{
+		close (p [0]);
+		WalkerOutput = p [1];
+		recurseUsingOpendir (dirName);
+		flushWalkerBuffer ();
+		close (WalkerOutput);
+		fflush (stderr);
+		_exit (0);
+	}
+	close (p [1]);
+
+	verbose ("walking \"%s\" in process %ld\n", dirName, (long) pid);
+
+	vString *entryName = vStringNew ();
+	bool removed = false;
+	char buffer [4096];
+	ssize_t n;
+	while ((n = read (p [0], buffer, sizeof (buffer))) != 0)
+	{
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			error (FATAL | PERROR, "cannot read file names from the walker");
+		}
+
+		for (ssize_t i = 0; i < n; i++)
+		{
+			if (buffer [i] != '\0')
+				vStringPut (entryName, buffer [i]);
+			else if (vStringIsEmpty (entryName))
+				removed = true;
+			else
+			{
+				if (removed)
+					noteReparsedInputFile (vStringValue (entryName));
+				else
+					resize |= createTagsForFile (vStringValue (entryName));
+				removed = false;
+				vStringClear (entryName);
+			}
+		}
+	}
+	vStringDelete (entryName);
+	close (p [0]);
+
+	if (waitpid (pid, &status, 0) == -1)
+		error (FATAL | PERROR, "cannot wait the process walking \"%s\"", dirName);
+	if (! WIFEXITED (status) || WEXITSTATUS (status) != 0)
+		error (FATAL, "failed in walking \"%s\"", dirName);
+
+	return resize;
+}
+
+static void passEntryToJob (const char *const entryName)
+{
+	FILE *const fp = Job.outputs [Job.nth++ % Job.count];
+
+	if (fputs (entryName, fp) == EOF || putc ('\0', fp) == EOF)
+		error (FATAL | PERROR, "cannot pass file names to the jobs");
+}
+
+static void endPassingEntriesToJobs (void)
+{
+	for (unsigned int i = 0; i < Job.count; i++)
+	{
+		if (putc ('\0', Job.outputs [i]) == EOF)
+			error (FATAL | PERROR, "cannot pass file names to the jobs");
+	}
+}
+
+/*  Parse the files passed for an input, in a worker.
+ */
+static bool createTagsForPassedEntries (void)
+{
+	bool resize = false;
+	vString *entryName = vStringNew ();
+	int c;
+
+	while ((c = getc (Job.input)) != EOF)
+	{
+		if (c != '\0')
+			vStringPut (entryName, c);
+		else if (vStringIsEmpty (entryName))
+			break;
+		else
+		{
+			resize |= createTagsForFile (vStringValue (entryName));
+			vStringClear (entryName);
+		}
+	}
+	vStringDelete (entryName);
+	return resize;
+}
+#endif
+
+static bool recurseIntoDirectory (const char *const dirName, bool mayBeLink)
 {
 	static unsigned int recursionDepth = 0;
 
 	recursionDepth++;
 
 	bool resize = false;
-	if (isRecursiveLink (dirName))
+	if (mayBeLink && isRecursiveLink (dirName))
 		verbose ("ignoring \"%s\" (recursive link)\n", dirName);
 	else if (! Option.recurse)
 		verbose ("ignoring \"%s\" (directory)\n", dirName);
@@ -180,8 +479,14 @@ static bool recurseIntoDirectory (const char *const dirName)
 	else
 	{
 		verbose ("RECURSING into directory \"%s\"\n", dirName);
+		bool pushed = Option.excludeIgnoreFile && pushIgnoreFrame (dirName);
 #if defined (HAVE_OPENDIR) && (defined (HAVE_DIRENT_H) || defined (_MSC_VER))
-		resize = recurseUsingOpendir (dirName);
+# ifdef JOBS_SUPPORTED
+		if (Option.walkAhead && WalkerOutput == -1 && Job.outputs == NULL)
+			resize = recurseUsingWalker (dirName);
+		else
+# endif
+			resize = recurseUsingOpendir (dirName);
 #elif defined (HAVE__FINDFIRST)
 		{
 			vString *const pattern = vStringNew ();
@@ -192,6 +497,8 @@ static bool recurseIntoDirectory (const char *const dirName)
 			vStringDelete (pattern);
 		}
 #endif
+		if (pushed)
+			popIgnoreFrame ();
 	}
 
 	recursionDepth--;
@@ -199,28 +506,120 @@ static bool recurseIntoDirectory (const char *const dirName)
 	return resize;
 }
 
+/*  INPUTNAME is given on the command line or in a list file, or is "."
+ *  for --recurse without input.
+ */
+static bool createTagsForInput (const char *const inputName, bool recursing)
+{
+	bool resize;
+
+#ifdef JOBS_SUPPORTED
+	if (Job.input != NULL)
+		return createTagsForPassedEntries ();
+#endif
+
+	if (recursing)
+		resize = recurseIntoDirectory (inputName, true);
+	else
+		resize = createTagsForEntry (inputName);
+
+#ifdef JOBS_SUPPORTED
+	if (Job.outputs != NULL)
+		endPassingEntriesToJobs ();
+#endif
+	return resize;
+}
+
+static bool createTagsWithCache (const char *const fileName,
+								 unsigned long size, time_t mtime)
+{
+	bool resize;
+
+	if (replayCachedTags (fileName, size, mtime))
+		return false;
+
+	beginCachingTags (fileName, size, mtime);
+	resize = parseFile (fileName);
+	endCachingTags ();
+
+	return resize;
+}
+
+/*  Parse ENTRYNAME, a regular file that is not excluded.
+ */
+static bool createTagsForFile (const char *const entryName)
+{
+	bool resize;
+
+	if (Option.cache)
+	{
+		fileStatus *status = eStat (entryName);
+		resize = createTagsWithCache (entryName, status->size, status->mtime);
+		eStatFree (status);
+	}
+	else
+		resize = parseFile (entryName);
+	return resize;
+}
+
 static bool createTagsForEntry (const char *const entryName)
 {
-	bool resize = false;
+	Assert (entryName != NULL);
+
 	fileStatus *status = eStat (entryName);
+	bool resize = createTagsForEntryWithStatus (entryName, status);
+
+	eStatFree (status);
+	return resize;
+}
+
+/*  STATUS may be filled only partially from the type of a directory
+ *  entry; then its name is NULL.
+ */
+static bool createTagsForEntryWithStatus (const char *const entryName,
+										  fileStatus *status)
+{
+	bool resize = false;
 
-	Assert (entryName != NULL);
 	if (isExcludedFile (entryName, true))
 		verbose ("excluding \"%s\" (the early stage)\n", entryName);
 	else if (status->isSymbolicLink  &&  ! Option.followLinks)
 		verbose ("ignoring \"%s\" (symbolic link)\n", entryName);
 	else if (! status->exists)
+	{
 		error (WARNING | PERROR, "cannot open input file \"%s\"", entryName);
+		if (Option.update)
+		{
+			/* Drop the tags of the removed input file. */
+#ifdef JOBS_SUPPORTED
+			if (WalkerOutput != -1)
+				passRemovedEntryToParser (entryName);
+			else
+#endif
+				noteReparsedInputFile (entryName);
+		}
+	}
+	else if (IgnoreFrames && isIgnoredEntry (entryName, status->isDirectory))
+		verbose ("excluding \"%s\" (%s)\n", entryName, Option.excludeIgnoreFile);
+	else if (status->isDirectory && isExcludedDirectory (entryName))
+		verbose ("excluding \"%s\" (directory)\n", entryName);
 	else if (status->isDirectory)
-		resize = recurseIntoDirectory (entryName);
+		resize = recurseIntoDirectory (entryName, status->isSymbolicLink);
 	else if (! status->isNormalFile)
 		verbose ("ignoring \"%s\" (special file)\n", entryName);
 	else if (isExcludedFile (entryName, false))
 		verbose ("excluding \"%s\"\n", entryName);
+#ifdef JOBS_SUPPORTED
+	else if (WalkerOutput != -1)
+		passEntryToParser (entryName);
+	else if (Job.outputs != NULL)
+		passEntryToJob (entryName);
+#endif
+	else if (Option.cache && status->name != NULL)
+		resize = createTagsWithCache (entryName, status->size, status->mtime);
 	else
-		resize = parseFile (entryName);
+		resize = createTagsForFile (entryName);
 
-	eStatFree (status);
 	return resize;
 }
 
@@ -263,7 +662,7 @@ static bool createTagsForArgs (cookedArgs *const args)
 #ifdef MANUAL_GLOBBING
 		resize |= createTagsForWildcardArg (arg);
 #else
-		resize |= createTagsForEntry (arg);
+		resize |= createTagsForInput (arg, false);
 #endif
 		cArgForth (args);
 		parseCmdlineOptions (args);
@@ -282,7 +681,7 @@ static bool createTagsFromFileInput (FILE *const fp, const bool filter)
 		parseCmdlineOptions (args);
 		while (! cArgOff (args))
 		{
-			resize |= createTagsForEntry (cArgItem (args));
+			resize |= createTagsForInput (cArgItem (args), false);
 			if (filter)
 			{
 				if (Option.filterTerminator != NULL)
@@ -332,6 +731,243 @@ static void runMainLoop (cookedArgs *args)
 	(* mainLoop) (args, mainData);
 }
 
+static bool createTagsForInputs (cookedArgs *args, bool files)
+{
+	bool resize = false;
+
+	if (! cArgOff (args))
+	{
+		verbose ("Reading command line arguments\n");
+		resize = createTagsForArgs (args);
+	}
+	if (Option.fileList != NULL)
+	{
+		verbose ("Reading list file\n");
+		resize = (bool) (createTagsFromListFile (Option.fileList) || resize);
+	}
+	if (Option.filter)
+	{
+		verbose ("Reading filter input\n");
+		resize = (bool) (createTagsFromFileInput (stdin, true) || resize);
+	}
+	if (! files  &&  Option.recurse)
+		resize = createTagsForInput (".", true);
+
+	return resize;
+}
+
+#ifdef JOBS_SUPPORTED
+struct sJobReport {
+	unsigned long added;
+	long files, lines, bytes;
+	struct corkTotals cork;
+};
+
+static bool canRunJobs (void)
+{
+	if (Option.jobs <= 1)
+		return false;
+
+	if (Option.filter || Option.printLanguage)
+		return false;
+
+	if (Option.regexStats)
+	{
+		verbose ("running no parallel job: regex statistics are collected in this process\n");
+		return false;
+	}
+
+	if (Option.fileList != NULL && strcmp (Option.fileList, "-") == 0)
+	{
+		verbose ("running no parallel job: the list file is read from stdin\n");
+		return false;
+	}
+
+	return true;
+}
+
+static void runJob (cookedArgs *args, bool files, unsigned int index,
+					const char *tagsName, const char *ptagsName,
+					const char *inputsName, const char *cacheName,
+					int input, int fd)
+{
+	struct sJobReport report;
+
+	Job.input = fdopen (input, "r");
+	if (Job.input == NULL)
+		error (FATAL | PERROR, "cannot read the file names passed to job %u", index);
+
+	redirectTagFileForJob (tagsName, ptagsName, inputsName);
+	if (cacheName)
+		redirectTagCacheForJob (cacheName);
+	bool resize = createTagsForInputs (args, files);
+	report.added = closeJobTagFile (resize);
+	if (cacheName)
+		closeJobTagCache ();
+	fclose (Job.input);
+	getTotals (&report.files, &report.lines, &report.bytes);
+	getCorkTotals (&report.cork);
+
+	if (write (fd, &report, sizeof (report)) != sizeof (report))
+		error (FATAL | PERROR, "cannot report the result of job %u", index);
+	close (fd);
+
+	fflush (stdout);
+	fflush (stderr);
+	_exit (0);
+}
+
+/*  Fork Option.jobs worker processes, pass the input files to them,
+ *  wait for them, and merge their outputs into the tag file opened in
+ *  this process.
+ */
+static bool runJobs (cookedArgs *args, bool files)
+{
+	const unsigned int count = Option.jobs;
+	char **tagsNames = xCalloc (count, char *);
+	char **ptagsNames = xCalloc (count, char *);
+	char **inputsNames = xCalloc (count, char *);
+	char **cacheNames = xCalloc (count, char *);
+	pid_t *pids = xMalloc (count, pid_t);
+	int *fds = xMalloc (count, int);
+	int *inputFds = xMalloc (count, int);
+	struct sJobReport *reports = xCalloc (count, struct sJobReport);
+	bool failed = false;
+	unsigned int i;
+
+	verbose ("running %u parallel jobs\n", count);
+	for (i = 0; i < count; i++)
+	{
+		mio_unref (tempFile ("w", tagsNames + i));
+		mio_unref (tempFile ("w", ptagsNames + i));
+		if (Option.update)
+			mio_unref (tempFile ("w", inputsNames + i));
+		if (Option.cache)
+			mio_unref (tempFile ("w", cacheNames + i));
+	}
+
+	/* Nothing buffered must be written twice. */
+	flushTagFile ();
+	fflush (stdout);
+	fflush (stderr);
+
+	for (i = 0; i < count; i++)
+	{
+		int p[2], q[2];
+
+		if (pipe (p) == -1 || pipe (q) == -1)
+			error (FATAL | PERROR, "cannot create a pipe for job %u", i);
+
+		pids [i] = fork ();
+		if (pids [i] == -1)
+			error (FATAL | PERROR, "cannot fork job %u", i);
+		else if (pids [i] == 0)
+		{
+			close (p [0]);
+			close (q [1]);
+			for (unsigned int j = 0; j < i; j++)
+			{
+				close (fds [j]);
+				close (inputFds [j]);
+			}
+			runJob (args, files, i, tagsNames [i], ptagsNames [i],
+					inputsNames [i], cacheNames [i], q [0], p [1]);
+		}
+		close (p [1]);
+		close (q [0]);
+		fds [i] = p [0];
+		inputFds [i] = q [1];
+	}
+
+	Job.outputs = xMalloc (count, FILE *);
+	Job.count = count;
+	Job.nth = 0;
+	for (i = 0; i < count; i++)
+	{
+		Job.outputs [i] = fdopen (inputFds [i], "w");
+		if (Job.outputs [i] == NULL)
+			error (FATAL | PERROR, "cannot pass file names to job %u", i);
+	}
+
+	createTagsForInputs (args, files);
+
+	for (i = 0; i < count; i++)
+	{
+		if (fclose (Job.outputs [i]) == EOF)
+			error (FATAL | PERROR, "cannot pass file names to job %u", i);
+	}
+	eFree (Job.outputs);
+	Job.outputs = NULL;
+
+	for (i = 0; i < count; i++)
+	{
+		int status;
+		ssize_t n = read (fds [i], reports + i, sizeof (reports [i]));
+
+		close (fds [i]);
+		if (waitpid (pids [i], &status, 0) == -1
+			|| !WIFEXITED (status) || WEXITSTATUS (status) != 0
+			|| n != sizeof (reports [i]))
+		{
+			error (WARNING, "job %u failed", i);
+			failed = true;
+		}
+	}
+
+	if (! failed)
+	{
+		mergeJobPseudoTagFiles (ptagsNames, count);
+		for (i = 0; i < count; i++)
+		{
+			mergeJobTagFile (tagsNames [i], reports [i].added);
+			if (inputsNames [i])
+				mergeJobInputFileList (inputsNames [i]);
+			if (cacheNames [i])
+				mergeJobTagCache (cacheNames [i]);
+			addTotals ((unsigned int) reports [i].files,
+					   (unsigned long) reports [i].lines,
+					   (unsigned long) reports [i].bytes);
+			addCorkTotals (reports [i].cork.entries,
+						   reports [i].cork.savedAllocations,
+						   reports [i].cork.internedStrings,
+						   reports [i].cork.arenaBytes);
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		remove (tagsNames [i]);
+		eFree (tagsNames [i]);
+		remove (ptagsNames [i]);
+		eFree (ptagsNames [i]);
+		if (inputsNames [i])
+		{
+			remove (inputsNames [i]);
+			eFree (inputsNames [i]);
+		}
+		if (cacheNames [i])
+		{
+			remove (cacheNames [i]);
+			eFree (cacheNames [i]);
+		}
+	}
+	eFree (tagsNames);
+	eFree (ptagsNames);
+	eFree (inputsNames);
+	eFree (cacheNames);
+	eFree (pids);
+	eFree (fds);
+	eFree (inputFds);
+	eFree (reports);
+
+	if (failed)
+		error (FATAL, "failed in running parallel jobs");
+
+	/* The workers have already shrunk their outputs. */
+	return false;
+}
+#endif
+
 static void batchMakeTags (cookedArgs *args, void *user CTAGS_ATTR_UNUSED)
 {
 	clock_t timeStamps [3];
@@ -350,80 +986,149 @@ static void batchMakeTags (cookedArgs *args, void *user CTAGS_ATTR_UNUSED)
 
 #define timeStamp(n) timeStamps[(n)]=(Option.printTotals ? clock():(clock_t)0)
 	if ((! Option.filter) && (! Option.printLanguage))
+	{
 		openTagFile ();
+		if (Option.cache)
+			openTagCache ();
+	}
 
 	timeStamp (0);
 
-	if (! cArgOff (args))
-	{
-		verbose ("Reading command line arguments\n");
-		resize = createTagsForArgs (args);
-	}
-	if (Option.fileList != NULL)
-	{
-		verbose ("Reading list file\n");
-		resize = (bool) (createTagsFromListFile (Option.fileList) || resize);
-	}
-	if (Option.filter)
-	{
-		verbose ("Reading filter input\n");
-		resize = (bool) (createTagsFromFileInput (stdin, true) || resize);
-	}
-	if (! files  &&  Option.recurse)
-		resize = recurseIntoDirectory (".");
+#ifdef JOBS_SUPPORTED
+	if (canRunJobs ())
+		resize = runJobs (args, files);
+	else
+#endif
+		resize = createTagsForInputs (args, files);
 
 	timeStamp (1);
 
 	if ((! Option.filter) && (!Option.printLanguage))
+	{
+		if (Option.cache)
+			closeTagCache ();
 		closeTagFile (resize);
+		if (Option.index)
+			writeTagIndex (Option.tagFileName);
+	}
 
 	timeStamp (2);
 
 	if (Option.printTotals)
 	{
-		printTotals (timeStamps, Option.append, Option.sorted);
+		printTotals (timeStamps, Option.append || Option.update, Option.sorted);
 		if (Option.printTotals > 1)
 			for (unsigned int i = 0; i < countParsers(); i++)
 				printParserStatisticsIfUsed (i);
 	}
 
+	if (Option.regexStats)
+		for (unsigned int i = 0; i < countParsers(); i++)
+			printRegexStatisticsIfUsed (i);
+
 #undef timeStamp
 }
 
 #ifdef HAVE_JANSSON
-void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
+/*  A client of interactive mode: stdin and stdout, or a connection to
+ *  the socket of the server submode. A client may send requests without
+ *  waiting for the responses; they are read and answered in order.
+ */
+struct interactiveSession {
+	MIO *in;
+	FILE *out;
+	MIO *outMio;
+	bool sandbox;
+};
+
+static void generateTagsForRequest (struct interactiveSession *session,
+									const char *filename, json_int_t size)
 {
-	struct interactiveModeArgs *iargs = user;
+	if (size == -1)
+	{					/* read from disk */
+		if (session->sandbox)
+			error (FATAL,
+				   "invalid request in sandbox submode: reading file contents from a file is limited");
+		else
+			createTagsForEntry (filename);
+	}
+	else
+	{					/* read nbytes from stream */
+		unsigned char *data = eMalloc (size);
+		size = mio_read (session->in, data, 1, size);
+		MIO *mio = mio_new_memory (data, size, eRealloc, eFreeNoNullCheck);
+		parseFileWithMio (filename, mio, NULL);
+		mio_unref (mio);
+	}
+	flushTagStream ();
+}
 
-	if (iargs->sandbox) {
-		/* As of jansson 2.6, the object hashing is seeded off
-		   of /dev/urandom, so trigger the hash seeding
-		   before installing the syscall filter.
-		*/
-		json_t * tmp = json_object ();
-		json_decref (tmp);
+/*  "filename" names a file; with "size", the contents of the file follow
+ *  the request. "filenames", an array, names files to parse in a batch.
+ */
+static void handleGenerateTagsRequest (struct interactiveSession *session,
+									   json_t *request)
+{
+	json_int_t size = -1;
+	const char *filename;
+	json_t *filenames = NULL;
 
-		if (installSyscallFilter ()) {
-			error (FATAL, "install_syscall_filter failed");
-			/* The explicit exit call is needed because
-			   "error (FATAL,..." just prints a message in
-			   interactive mode. */
-			exit (1);
+	if (json_unpack (request, "{so}", "filenames", &filenames) == 0)
+	{
+		if (! json_is_array (filenames)
+			|| (session->sandbox && json_array_size (filenames) > 0))
+		{
+			error (FATAL, "invalid generate-tags request");
+			return;
 		}
 	}
+	else if (json_unpack (request, "{ss}", "filename", &filename) == -1)
+	{
+		error (FATAL, "invalid generate-tags request");
+		return;
+	}
+	else
+		json_unpack (request, "{sI}", "size", &size);
 
-	char buffer[1024];
+	openTagStream (session->outMio);
+	if (filenames)
+	{
+		size_t i;
+		json_t *value;
+
+		json_array_foreach (filenames, i, value)
+		{
+			if (json_is_string (value))
+				generateTagsForRequest (session, json_string_value (value), -1);
+			else
+				error (FATAL, "invalid file name in generate-tags request");
+		}
+	}
+	else
+		generateTagsForRequest (session, filename, size);
+	closeTagStream ();
+
+	fputs ("{\"_type\": \"completed\", \"command\": \"generate-tags\"}\n", session->out);
+}
+
+/*  Return false if the client asks the server to shut down.
+ */
+static bool runInteractiveSession (struct interactiveSession *session)
+{
+	vString *line = vStringNew ();
+	bool running = true;
 	json_t *request;
 
-	fputs ("{\"_type\": \"program\", \"name\": \"" PROGRAM_NAME "\", \"version\": \"" PROGRAM_VERSION "\"}\n", stdout);
-	fflush (stdout);
+	fputs ("{\"_type\": \"program\", \"name\": \"" PROGRAM_NAME "\", \"version\": \"" PROGRAM_VERSION "\"}\n", session->out);
+	fflush (session->out);
 
-	while (fgets (buffer, sizeof(buffer), stdin))
+	while (running && readLineRaw (line, session->in) != NULL)
 	{
-		if (buffer[0] == '\n')
+		vStringStripNewline (line);
+		if (vStringIsEmpty (line))
 			continue;
 
-		request = json_loads (buffer, JSON_DISABLE_EOF_CHECK, NULL);
+		request = json_loads (vStringValue (line), JSON_DISABLE_EOF_CHECK, NULL);
 		if (! request)
 		{
 			error (FATAL, "invalid json");
@@ -431,59 +1136,144 @@ void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
 		}
 
 		json_t *command = json_object_get (request, "command");
-		if (! command)
+		if (! command || ! json_is_string (command))
 		{
 			error (FATAL, "command name not found");
 			goto next;
 		}
 
 		if (!strcmp ("generate-tags", json_string_value (command)))
+			handleGenerateTagsRequest (session, request);
+		else if (!strcmp ("shutdown", json_string_value (command))
+				 && Option.interactive == INTERACTIVE_SERVER)
 		{
-			json_int_t size = -1;
-			const char *filename;
+			fputs ("{\"_type\": \"completed\", \"command\": \"shutdown\"}\n", session->out);
+			running = false;
+		}
+		else
+			error (FATAL, "unknown command name");
 
-			if (json_unpack (request, "{ss}", "filename", &filename) == -1)
-			{
-				error (FATAL, "invalid generate-tags request");
-				goto next;
-			}
+	next:
+		fflush (session->out);
+		json_decref (request);
+	}
 
-			json_unpack (request, "{sI}", "size", &size);
+	vStringDelete (line);
+	return running;
+}
 
-			openTagFile ();
-			if (size == -1)
-			{					/* read from disk */
-				if (iargs->sandbox) {
-					error (FATAL,
-						   "invalid request in sandbox submode: reading file contents from a file is limited");
-					closeTagFile (false);
-					goto next;
-				}
+#ifdef INTERACTIVE_SERVER_SUPPORTED
+/*  Serve the clients connecting to SOCKETNAME one by one. The options,
+ *  and the parsers initialized for a client, are kept for the next.
+ */
+static void serveInteractiveSessions (const char *const socketName)
+{
+	struct sockaddr_un addr;
+	int listener;
+	bool running = true;
 
-				createTagsForEntry (filename);
-			}
-			else
-			{					/* read nbytes from stream */
-				unsigned char *data = eMalloc (size);
-				size = fread (data, 1, size, stdin);
-				MIO *mio = mio_new_memory (data, size, eRealloc, eFreeNoNullCheck);
-				parseFileWithMio (filename, mio, NULL);
-				mio_unref (mio);
-			}
+	if (strlen (socketName) >= sizeof (addr.sun_path))
+	{
+		error (FATAL, "too long socket name: %s", socketName);
+		exit (1);
+	}
 
-			closeTagFile (false);
-			fputs ("{\"_type\": \"completed\", \"command\": \"generate-tags\"}\n", stdout);
-			fflush(stdout);
+	memset (&addr, 0, sizeof (addr));
+	addr.sun_family = AF_UNIX;
+	strcpy (addr.sun_path, socketName);
+
+	listener = socket (AF_UNIX, SOCK_STREAM, 0);
+	if (listener == -1
+		|| bind (listener, (struct sockaddr *) &addr, sizeof (addr)) == -1
+		|| listen (listener, 16) == -1)
+	{
+		error (FATAL | PERROR, "cannot listen on socket \"%s\"", socketName);
+		exit (1);
+	}
+
+	/* A client going away must not kill the server. */
+	signal (SIGPIPE, SIG_IGN);
+
+	while (running)
+	{
+		int fd = accept (listener, NULL, NULL);
+		if (fd == -1)
+		{
+			if (errno == EINTR)
+				continue;
+			error (FATAL | PERROR, "cannot accept a client");
+			break;
 		}
-		else
+
+		int fd2 = dup (fd);
+		FILE *in = fdopen (fd, "r");
+		FILE *out = (fd2 == -1)? NULL: fdopen (fd2, "w");
+		if (in == NULL || out == NULL)
 		{
-			error (FATAL, "unknown command name");
-			goto next;
+			error (WARNING | PERROR, "cannot open the connection to a client");
+			if (in) fclose (in); else close (fd);
+			if (out) fclose (out); else if (fd2 != -1) close (fd2);
+			continue;
 		}
 
-	next:
-		json_decref (request);
+		struct interactiveSession session = {
+			.in = mio_new_fp (in, fclose),
+			.out = out,
+			.outMio = mio_new_fp (out, NULL),
+			.sandbox = false,
+		};
+		setErrorPrinter (jsonErrorPrinter, out);
+		running = runInteractiveSession (&session);
+		setErrorPrinter (jsonErrorPrinter, NULL);
+
+		mio_unref (session.outMio);
+		fclose (out);
+		mio_unref (session.in);
+	}
+
+	close (listener);
+	remove (socketName);
+}
+#endif
+
+void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
+{
+	struct interactiveModeArgs *iargs = user;
+
+	if (iargs->sandbox) {
+		/* As of jansson 2.6, the object hashing is seeded off
+		   of /dev/urandom, so trigger the hash seeding
+		   before installing the syscall filter.
+		*/
+		json_t * tmp = json_object ();
+		json_decref (tmp);
+
+		if (installSyscallFilter ()) {
+			error (FATAL, "install_syscall_filter failed");
+			/* The explicit exit call is needed because
+			   "error (FATAL,..." just prints a message in
+			   interactive mode. */
+			exit (1);
+		}
+	}
+
+#ifdef INTERACTIVE_SERVER_SUPPORTED
+	if (iargs->socketName)
+	{
+		serveInteractiveSessions (iargs->socketName);
+		return;
 	}
+#endif
+
+	struct interactiveSession session = {
+		.in = mio_new_fp (stdin, NULL),
+		.out = stdout,
+		.outMio = mio_new_fp (stdout, NULL),
+		.sandbox = iargs->sandbox,
+	};
+	runInteractiveSession (&session);
+	mio_unref (session.outMio);
+	mio_unref (session.in);
 }
 #endif
 
@@ -544,6 +1334,45 @@ static void sanitizeEnviron (void)
 	}
 }
 
+#if defined (SIGBUS) && defined (SA_SIGINFO)
+/*  A large input file is mapped into memory. If another process truncates
+ *  it while it is read, reading past its new end raises SIGBUS. The parser
+ *  cannot go on then; report it and exit instead of dying silently. Only
+ *  async-signal-safe functions may be called here.
+ */
+static struct sigaction PreviousSigbusAction;
+
+static void handleSigbus (int sig CTAGS_ATTR_UNUSED, siginfo_t *info,
+						  void *context CTAGS_ATTR_UNUSED)
+{
+	static const char message [] = "ctags: an input file was truncated while it was read\n";
+
+	if (mio_is_mapped_address (info->si_addr))
+	{
+		ssize_t n CTAGS_ATTR_UNUSED = write (STDERR_FILENO, message,
+											 sizeof (message) - 1);
+		_exit (1);
+	}
+
+	/* The access faults again, and the previous handler takes it. */
+	sigaction (SIGBUS, &PreviousSigbusAction, NULL);
+}
+#endif
+
+static void setupInputFileMapping (void)
+{
+#if defined (SIGBUS) && defined (SA_SIGINFO)
+	struct sigaction action;
+
+	memset (&action, 0, sizeof (action));
+	action.sa_sigaction = handleSigbus;
+	action.sa_flags = SA_SIGINFO;
+	sigemptyset (&action.sa_mask);
+	if (sigaction (SIGBUS, &action, &PreviousSigbusAction) == 0)
+		enableInputFileMapping ();
+#endif
+}
+
 /*
  *		Start up code
  */
@@ -568,6 +1397,7 @@ extern int ctags_cli_main (int argc CTAGS_ATTR_UNUSED, char **argv)
 	setCurrentDirectory ();
 	setExecutableName (*argv++);
 	sanitizeEnviron ();
+	setupInputFileMapping ();
 	checkRegex ();
 	initFieldObjects ();
 	initXtagObjects ();
@@ -48,6 +48,13 @@
 #include <unistd.h>
 #endif
 
+#if defined (HAVE_MMAP) && defined (HAVE_SYS_MMAN_H)
+#define MAY_HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+
 #ifdef READTAGS_DSL
 #define xMalloc(n,Type)    (Type *)eMalloc((size_t)(n) * sizeof (Type))
 #define xRealloc(p,n,Type) (Type *)eRealloc((p), (n) * sizeof (Type))
@@ -107,8 +114,8 @@ static void eFree (void *const ptr)
  * file based operations and in-memory operations. Its goal is to ease the port
  * of an application that uses C file I/O API to perform in-memory operations.
  *
- * A #MIO object is created using mio_new_file(), mio_new_memory() or mio_new_mio(),
- * depending on whether you want file or in-memory operations.
+ * A #MIO object is created using mio_new_file(), mio_new_memory(), mio_new_mmap()
+ * or mio_new_mio(), depending on whether you want file or in-memory operations.
  * Its life is managed by reference counting. Just after calling one of functions
  * for creating, the count is 1. mio_ref() increments the counter. mio_unref()
  * decrements it. When the counter becomes 0, the #MIO object will be destroyed
@@ -157,6 +164,8 @@ struct _MIO {
 			MIODestroyNotify free_func;
 			bool error;
 			bool eof;
+			bool mapped;
+			struct _MIO *next_mapped;
 		} mem;
 	} impl;
 	MIOUserData udata;
@@ -338,6 +347,8 @@ MIO *mio_new_memory (unsigned char *data,
 		mio->impl.mem.free_func = free_func;
 		mio->impl.mem.eof = false;
 		mio->impl.mem.error = false;
+		mio->impl.mem.mapped = false;
+		mio->impl.mem.next_mapped = NULL;
 		mio->refcount = 1;
 		mio->udata.d = NULL;
 		mio->udata.f = NULL;
@@ -346,6 +357,99 @@ MIO *mio_new_memory (unsigned char *data,
 	return mio;
 }
 
+#ifdef MAY_HAVE_MMAP
+/* The MIOs made by mio_new_mmap(), for mio_is_mapped_address(). */
+static MIO *mapped_mios;
+
+static void unlink_mapped_mio (MIO *mio)
+{
+	for (MIO **p = &mapped_mios; *p; p = &(*p)->impl.mem.next_mapped)
+	{
+		if (*p == mio)
+		{
+			*p = mio->impl.mem.next_mapped;
+			break;
+		}
+	}
+}
+#endif
+
+/**
+ * mio_new_mmap:
+ * @filename: Filename of a regular file to map
+ *
+ * Creates a new #MIO object working on memory, where the whole content of
+ * a file is mapped with mmap(). Reading from the object doesn't copy the
+ * content of the file, and mio_memory_get_data() returns the mapped
+ * memory.
+ *
+ * The buffer cannot grow. Writing to the object never changes the file.
+ *
+ * If the file is truncated while it is mapped, reading a page past its new
+ * end raises SIGBUS. Nothing is done for it here; a program mapping files
+ * that may be truncated should handle the signal, using
+ * mio_is_mapped_address() to tell such a fault from others.
+ *
+ * Free-function: mio_unref()
+ *
+ * Returns: A new #MIO on success, or %NULL if the file cannot be mapped,
+ *          the file is empty or not a regular file, or mmap() is not
+ *          available on the platform.
+ */
+MIO *mio_new_mmap (const char *filename)
+{
+#ifdef MAY_HAVE_MMAP
+	struct stat st;
+	void *data;
+	size_t size;
+	MIO *mio;
+	int fd;
+
+	fd = open (filename, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	if (fstat (fd, &st) != 0 || ! S_ISREG (st.st_mode) || st.st_size <= 0
+		|| (unsigned long long) st.st_size > (size_t) -1)
+	{
+		close (fd);
+		return NULL;
+	}
+	size = (size_t) st.st_size;
+
+	/* With MAP_PRIVATE, writing makes a private copy of the page. */
+	data = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+	{
+		close (fd);
+		return NULL;
+	}
+
+	/* The file may be being rewritten. */
+	if (fstat (fd, &st) != 0 || st.st_size != (off_t) size)
+	{
+		munmap (data, size);
+		close (fd);
+		return NULL;
+	}
+	close (fd);
+
+	mio = mio_new_memory (data, size, NULL, NULL);
+	if (! mio)
+	{
+		munmap (data, size);
+		return NULL;
+	}
+	mio->impl.mem.mapped = true;
+	mio->impl.mem.next_mapped = mapped_mios;
+	mapped_mios = mio;
+
+	return mio;
+#else
+	return NULL;
+#endif
+}
+
 /**
  * mio_new_mio:
  * @base: The original mio
@@ -473,6 +577,54 @@ unsigned char *mio_memory_get_data (MIO *mio, size_t *size)
 	return ptr;
 }
 
+/**
+ * mio_memory_get_data_at:
+ * @mio: A #MIO object
+ * @pos: (in): A #MIOPos object filled-in by a previous call of mio_getpos()
+ *       on the same stream
+ * @size: (out): Return location for the length of the returned memory
+ *
+ * Gets the underlying memory buffer associated with a #MIO memory stream
+ * from the position @pos, without moving the cursor of the stream.
+ *
+ * Returns: The memory buffer of the given #MIO stream at @pos, or %NULL if
+ *          the stream is not a memory stream or @pos is out of the stream.
+ */
+unsigned char *mio_memory_get_data_at (MIO *mio, const MIOPos *pos, size_t *size)
+{
+	if (mio->type != MIO_TYPE_MEMORY || pos->type != MIO_TYPE_MEMORY
+		|| pos->impl.mem > mio->impl.mem.size)
+		return NULL;
+
+	*size = mio->impl.mem.size - pos->impl.mem;
+	return mio->impl.mem.buf + pos->impl.mem;
+}
+
+/**
+ * mio_is_mapped_address:
+ * @addr: An address
+ *
+ * Checks whether @addr is in the memory of a #MIO made with
+ * mio_new_mmap(). This only walks a list, and can be called from a signal
+ * handler as long as no #MIO is made or destroyed concurrently.
+ *
+ * Returns: %true if @addr is in a mapped file, %false otherwise.
+ */
+bool mio_is_mapped_address (const void *addr)
+{
+#ifdef MAY_HAVE_MMAP
+	const unsigned char *const p = addr;
+
+	for (MIO *mio = mapped_mios; mio; mio = mio->impl.mem.next_mapped)
+	{
+		if (p >= mio->impl.mem.buf
+			&& p < mio->impl.mem.buf + mio->impl.mem.allocated_size)
+			return true;
+	}
+#endif
+	return false;
+}
+
 /**
  * mio_unref:
  * @mio: A #MIO object
@@ -503,6 +655,14 @@ int mio_unref (MIO *mio)
 		}
 		else if (mio->type == MIO_TYPE_MEMORY)
 		{
+#ifdef MAY_HAVE_MMAP
+			if (mio->impl.mem.mapped)
+			{
+				unlink_mapped_mio (mio);
+				munmap (mio->impl.mem.buf, mio->impl.mem.allocated_size);
+			}
+			else
+#endif
 			if (mio->impl.mem.free_func)
 				mio->impl.mem.free_func (mio->impl.mem.buf);
 			mio->impl.mem.buf = NULL;
@@ -1294,6 +1454,33 @@ int mio_getpos (MIO *mio, MIOPos *pos)
 	return rv;
 }
 
+/**
+ * mio_memory_getpos_at:
+ * @mio: A #MIO stream of the memory type
+ * @offset: An offset in the stream
+ * @pos: (out): A #MIOPos object to fill-in
+ *
+ * Stores the position at @offset of a memory #MIO stream in @pos as
+ * mio_getpos() would do after seeking to @offset, but without moving the
+ * cursor of the stream.
+ *
+ * Returns: 0 on success, -1 if @mio is not a memory stream or @offset is
+ *          out of the stream.
+ */
+int mio_memory_getpos_at (MIO *mio, size_t offset, MIOPos *pos)
+{
+	if (mio->type != MIO_TYPE_MEMORY || offset > mio->impl.mem.size)
+		return -1;
+
+	pos->type = mio->type;
+	pos->impl.mem = offset;
+#ifdef MIO_DEBUG
+	pos->tag = mio;
+#endif /* MIO_DEBUG */
+
+	return 0;
+}
+
 /**
  * mio_setpos:
  * @mio: A #MIO object
@@ -123,12 +123,15 @@ MIO *mio_new_memory (unsigned char *data,
 					 MIOReallocFunc realloc_func,
 					 MIODestroyNotify free_func);
 
+MIO *mio_new_mmap   (const char *filename);
 MIO *mio_new_mio    (MIO *base, long start, long size);
 MIO *mio_ref        (MIO *mio);
 
 int mio_unref (MIO *mio);
 FILE *mio_file_get_fp (MIO *mio);
 unsigned char *mio_memory_get_data (MIO *mio, size_t *size);
+unsigned char *mio_memory_get_data_at (MIO *mio, const MIOPos *pos, size_t *size);
+bool mio_is_mapped_address (const void *addr);
 size_t mio_read (MIO *mio,
 				 void *ptr,
 				 size_t size,
@@ -153,6 +156,7 @@ int mio_seek (MIO *mio, long offset, int whence);
 long mio_tell (MIO *mio);
 void mio_rewind (MIO *mio);
 int mio_getpos (MIO *mio, MIOPos *pos);
+int mio_memory_getpos_at (MIO *mio, size_t offset, MIOPos *pos);
 int mio_setpos (MIO *mio, MIOPos *pos);
 int mio_flush (MIO *mio);
 
@@ -28,8 +28,10 @@
 #include "entry_p.h"
 #include "field_p.h"
 #include "gvars.h"
+#include "htable.h"
 #include "keyword_p.h"
 #include "parse_p.h"
+#include "pathmatch_p.h"
 #include "ptag_p.h"
 #include "routines_p.h"
 #include "xtag_p.h"
@@ -118,12 +120,15 @@ typedef const struct sBooleanOption {
 */
 
 static bool NonOptionEncountered = false;
-static stringList *OptionFiles;
+static unsigned int OptionsFingerprint = 0;	/* of all options processed */
+static hashTable *OptionFiles;
 
 typedef stringList searchPathList;
 static searchPathList *OptlibPathList;
 
 static stringList *Excluded, *ExcludedException;
+/* Compiled from the lists above on demand */
+static pathMatcher *ExcludedMatcher, *ExcludedExceptionMatcher;
 static bool FilesRequired = true;
 static bool SkipConfiguration;
 
@@ -136,6 +141,9 @@ bool ctags_verbose = false;
 
 optionValues Option = {
 	.append = false,
+	.update = false,
+	.cache = false,
+	.index = false,
 	.backward = false,
 	.etags = false,
 	.locate =
@@ -162,6 +170,7 @@ optionValues Option = {
 	.followLinks = true,
 	.filter = false,
 	.filterTerminator = NULL,
+	.excludeIgnoreFile = NULL,
 	.tagRelative = TREL_NO,
 	.printTotals = 0,
 	.lineDirectives = false,
@@ -169,9 +178,12 @@ optionValues Option = {
 	.guessLanguageEagerly = false,
 	.quiet = false,
 	.fatalWarnings = false,
+	.regexStats = false,
 	.patternLengthLimit = 96,
 	.putFieldPrefix = false,
 	.maxRecursionDepth = 0xffffffff,
+	.jobs = 1,
+	.walkAhead = false,
 	.interactive = false,
 	.fieldsReset = false,
 #ifdef WIN32
@@ -215,12 +227,21 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"  --exclude-exception=<pattern>"},
  {1,0,"      Don't exclude files and directories matching <pattern> even if"},
  {1,0,"      they match the pattern specified with --exclude option."},
+ {1,0,"  --exclude-ignore-file=<name>"},
+ {1,0,"      Exclude files and directories matching the patterns in the file <name>"},
+ {1,0,"      of each directory, written in the syntax of .gitignore, when recursing."},
  {1,0,"  --filter[=(yes|no)]"},
  {1,0,"       Behave as a filter, reading file names from standard input and"},
  {1,0,"       writing tags to standard output [no]."},
  {1,0,"  --filter-terminator=<string>"},
  {1,0,"       Specify <string> to print to stdout following the tags for each file"},
  {1,0,"       parsed when --filter is enabled."},
+ {1,0,"  --jobs=<N>"},
+#ifdef JOBS_SUPPORTED
+ {1,0,"       Parse input files with <N> parallel worker processes [1]."},
+#else
+ {1,0,"       Not supported on this platform."},
+#endif
  {1,0,"  --links[=(yes|no)]"},
  {1,0,"       Indicate whether symbolic links should be followed [yes]."},
  {1,0,"  --maxdepth=<N>"},
@@ -236,6 +257,13 @@ static optionDescription LongOptionDescription [] = {
 #else
  {1,0,"       Not supported on this platform."},
  {1,0,"  -R   Not supported on this platform."},
+#endif
+ {1,0,"  --walk-ahead[=(yes|no)]"},
+#ifdef JOBS_SUPPORTED
+ {1,0,"       Walk the directories of --recurse in another process while parsing"},
+ {1,0,"       the files found there [no]."},
+#else
+ {1,0,"       Not supported on this platform."},
 #endif
  {1,0,"  -L <file>"},
  {1,0,"       A list of input file names is read from the specified <file>."},
@@ -243,6 +271,12 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"  --append[=(yes|no)]"},
  {1,0,"       Should tags should be appended to existing tag file [no]?"},
  {1,0,"  -a   Append the tags to an existing tag file."},
+ {1,0,"  --update[=(yes|no)]"},
+ {1,0,"       Replace the tags of the input files in an existing sorted tag file [no]."},
+ {1,0,"  --cache[=(yes|no)]"},
+ {1,0,"       Reuse the tags of unchanged input files recorded in <tagfile>.cache [no]."},
+ {1,0,"  --index[=(yes|no)]"},
+ {1,0,"       Write <tagfile>.idx for fast tag lookups by name [no]."},
  {1,0,"  -f <tagfile>"},
  {1,0,"       Write tags to specified <tagfile>. Value of \"-\" writes tags to stdout"},
  {1,0,"       [\"tags\"; or \"TAGS\" when -e supplied]."},
@@ -520,7 +554,14 @@ static optionDescription LongOptionDescription [] = {
 #ifdef HAVE_SECCOMP
  {0,1,"       Enter file I/O limited interactive mode if sandbox is specified. [default]"},
 #endif
+#ifdef INTERACTIVE_SERVER_SUPPORTED
+ {0,1,"  --_interactive=server:<socket>"},
+ {0,1,"       Serve the clients connecting to the Unix domain socket <socket> in"},
+ {0,1,"       interactive mode."},
+#endif
 #endif
+ {1,1,"  --_regex-stats"},
+ {1,1,"       Print the time spent in each regex pattern of used parsers."},
 #ifdef DO_TRACING
  {1,1,"  --_trace=<list>"},
  {1,1,"       Trace parsers for the languages."},
@@ -608,6 +649,9 @@ static struct Feature {
 	{"optscript", "can use the interpreter"},
 #ifdef HAVE_PCRE2
 	{"pcre2", "has pcre2 regex engine"},
+#endif
+#ifdef JOBS_SUPPORTED
+	{"jobs", "can parse input files with parallel worker processes"},
 #endif
 	{NULL,}
 };
@@ -764,6 +808,44 @@ extern void checkOptions (void)
 		if (isDestinationStdout ())
 			error (FATAL, "%s tags to stdout", notice);
 	}
+	if (Option.update)
+	{
+		notice = "update mode is not compatible with";
+		if (isDestinationStdout ())
+			error (FATAL, "%s tags to stdout", notice);
+		if (Option.append)
+			error (FATAL, "%s append mode", notice);
+		if (Option.filter)
+			error (FATAL, "%s filter mode", notice);
+		if (! writerIsCtagsFormat ())
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+		if (Option.sorted == SO_UNSORTED)
+			error (FATAL, "%s unsorted tag file", notice);
+	}
+	if (Option.cache)
+	{
+		notice = "cache is not compatible with";
+		if (isDestinationStdout ())
+			error (FATAL, "%s tags to stdout", notice);
+		if (Option.append)
+			error (FATAL, "%s append mode", notice);
+		if (Option.update)
+			error (FATAL, "%s update mode", notice);
+		if (Option.filter)
+			error (FATAL, "%s filter mode", notice);
+		if (! writerIsCtagsFormat ())
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+	}
+	if (Option.index)
+	{
+		notice = "index is not compatible with";
+		if (isDestinationStdout ())
+			error (FATAL, "%s tags to stdout", notice);
+		if (Option.filter)
+			error (FATAL, "%s filter mode", notice);
+		if (! writerIsCtagsFormat ())
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+	}
 	if (Option.filter)
 	{
 		notice = "filter mode";
@@ -1164,10 +1246,26 @@ static void processEtagsInclude (
 	}
 }
 
+static void invalidateExcludeMatchers (void)
+{
+	if (ExcludedMatcher)
+	{
+		pathMatcherDelete (ExcludedMatcher);
+		ExcludedMatcher = NULL;
+	}
+	if (ExcludedExceptionMatcher)
+	{
+		pathMatcherDelete (ExcludedExceptionMatcher);
+		ExcludedExceptionMatcher = NULL;
+	}
+}
+
 static void processExcludeOptionCommon (
 	stringList** list, const char *const optname, const char *const parameter)
 {
 	const char *const fileName = parameter + 1;
+
+	invalidateExcludeMatchers ();
 	if (parameter [0] == '\0')
 		freeList (list);
 	else if (parameter [0] == '@')
@@ -1206,6 +1304,14 @@ static void processExcludeExceptionOption (
 	processExcludeOptionCommon (&ExcludedException, option, parameter);
 }
 
+static void processExcludeIgnoreFileOption (
+		const char *const option CTAGS_ATTR_UNUSED, const char *const parameter)
+{
+	freeString (&Option.excludeIgnoreFile);
+	if (parameter [0] != '\0')
+		Option.excludeIgnoreFile = stringCopy (parameter);
+}
+
 extern bool isExcludedFile (const char* const name,
 							bool falseIfExceptionsAreDefeind)
 {
@@ -1219,18 +1325,22 @@ extern bool isExcludedFile (const char* const name,
 
 	if (Excluded != NULL)
 	{
-		result = stringListFileMatched (Excluded, base);
+		if (ExcludedMatcher == NULL)
+			ExcludedMatcher = pathMatcherNew (Excluded);
+		result = pathMatcherMatch (ExcludedMatcher, base);
 		if (! result  &&  name != base)
-			result = stringListFileMatched (Excluded, name);
+			result = pathMatcherMatch (ExcludedMatcher, name);
 	}
 
 	if (result && ExcludedException != NULL)
 	{
 		bool result_exception;
 
-		result_exception = stringListFileMatched (ExcludedException, base);
+		if (ExcludedExceptionMatcher == NULL)
+			ExcludedExceptionMatcher = pathMatcherNew (ExcludedException);
+		result_exception = pathMatcherMatch (ExcludedExceptionMatcher, base);
 		if (! result_exception && name != base)
-			result_exception = stringListFileMatched (ExcludedException, name);
+			result_exception = pathMatcherMatch (ExcludedExceptionMatcher, name);
 
 		if (result_exception)
 			result = false;
@@ -1238,6 +1348,28 @@ extern bool isExcludedFile (const char* const name,
 	return result;
 }
 
+/* While --exclude-exception patterns are defined, an excluded directory
+ * is still descended so that the patterns can pick files in it. A
+ * directory can be skipped only when every path under it is excluded
+ * and no pattern of --exclude-exception may match one of them. */
+extern bool isExcludedDirectory (const char* const name)
+{
+	if (Excluded == NULL)
+		return false;
+
+	if (ExcludedMatcher == NULL)
+		ExcludedMatcher = pathMatcherNew (Excluded);
+	if (! pathMatcherMatchesAllUnder (ExcludedMatcher, name))
+		return false;
+
+	if (ExcludedException == NULL || stringListCount (ExcludedException) == 0)
+		return true;
+
+	if (ExcludedExceptionMatcher == NULL)
+		ExcludedExceptionMatcher = pathMatcherNew (ExcludedException);
+	return ! pathMatcherMayMatchUnder (ExcludedExceptionMatcher, name);
+}
+
 static void processExcmdOption (
 		const char *const option, const char *const parameter)
 {
@@ -1661,6 +1793,11 @@ static void processInteractiveOption (
 {
 	static struct interactiveModeArgs args;
 
+	if (args.socketName)
+	{
+		eFree (args.socketName);
+		args.socketName = NULL;
+	}
 
 	if (parameter && (strcmp (parameter, "sandbox") == 0))
 	{
@@ -1677,6 +1814,15 @@ static void processInteractiveOption (
 		Option.interactive = INTERACTIVE_DEFAULT;
 		args.sandbox = false;
 	}
+	else if (strncmp (parameter, "server:", 7) == 0 && parameter [7] != '\0')
+	{
+#ifndef INTERACTIVE_SERVER_SUPPORTED
+		error (FATAL, "server submode is not supported on this platform");
+#endif
+		Option.interactive = INTERACTIVE_SERVER;
+		args.sandbox = false;
+		args.socketName = eStrdup (parameter + 7);
+	}
 	else
 		error (FATAL, "Unknown option argument \"%s\" for --%s option",
 			   parameter, option);
@@ -2778,6 +2924,21 @@ static void processMaxRecursionDepthOption (const char *const option, const char
 	Option.maxRecursionDepth = atol(parameter);
 }
 
+static void processJobsOption (const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!strToUInt (parameter, 0, &Option.jobs) || Option.jobs < 1)
+		error (FATAL, "Invalid value for \"%s\" option", option);
+
+#ifndef JOBS_SUPPORTED
+	if (Option.jobs > 1)
+		error (WARNING, "--%s option is not supported on this host", option);
+	Option.jobs = 1;
+#endif
+}
+
 static void processPatternLengthLimit(const char *const option, const char *const parameter)
 {
 	if (parameter == NULL || parameter[0] == '\0')
@@ -2828,6 +2989,7 @@ static parametricOption ParametricOptions [] = {
 	{ "etags-include",          processEtagsInclude,            false,  STAGE_ANY },
 	{ "exclude",                processExcludeOption,           false,  STAGE_ANY },
 	{ "exclude-exception",      processExcludeExceptionOption,  false,  STAGE_ANY },
+	{ "exclude-ignore-file",    processExcludeIgnoreFileOption, false,  STAGE_ANY },
 	{ "excmd",                  processExcmdOption,             false,  STAGE_ANY },
 	{ "extra",                  processExtraTagsOption,         false,  STAGE_ANY },
 	{ "extras",                 processExtraTagsOption,         false,  STAGE_ANY },
@@ -2845,6 +3007,7 @@ static parametricOption ParametricOptions [] = {
 	{ "language",               processLanguageForceOption,     false,  STAGE_ANY },
 	{ "language-force",         processLanguageForceOption,     false,  STAGE_ANY },
 	{ "languages",              processLanguagesOption,         false,  STAGE_ANY },
+	{ "jobs",                   processJobsOption,              true,   STAGE_ANY },
 	{ "langdef",                processLanguageDefineOption,    false,  STAGE_ANY },
 	{ "langmap",                processLanguageMapOption,       false,  STAGE_ANY },
 	{ "license",                processLicenseOption,           true,   STAGE_ANY },
@@ -2898,10 +3061,12 @@ static parametricOption ParametricOptions [] = {
 
 static booleanOption BooleanOptions [] = {
 	{ "append",         &Option.append,                 true,  STAGE_ANY },
+	{ "cache",          &Option.cache,                  true,  STAGE_ANY },
 	{ "file-scope",     ((bool *)XTAG_FILE_SCOPE),      false, STAGE_ANY, setBooleanToXtagWithWarning },
 	{ "file-tags",      ((bool *)XTAG_FILE_NAMES),      false, STAGE_ANY, setBooleanToXtagWithWarning },
 	{ "filter",         &Option.filter,                 true,  STAGE_ANY },
 	{ "guess-language-eagerly", &Option.guessLanguageEagerly, false, STAGE_ANY },
+	{ "index",          &Option.index,                  true,  STAGE_ANY },
 	{ "line-directives",&Option.lineDirectives,         false, STAGE_ANY },
 	{ "links",          &Option.followLinks,            false, STAGE_ANY },
 	{ "machinable",     &localOption.machinable,        true,  STAGE_ANY },
@@ -2911,12 +3076,15 @@ static booleanOption BooleanOptions [] = {
 #ifdef RECURSE_SUPPORTED
 	{ "recurse",        &Option.recurse,                false, STAGE_ANY },
 #endif
+	{ "update",         &Option.update,                 true,  STAGE_ANY },
 	{ "verbose",        &ctags_verbose,                 false, STAGE_ANY },
+	{ "walk-ahead",     &Option.walkAhead,              false, STAGE_ANY },
 #ifdef WIN32
 	{ "use-slash-as-filename-separator", (bool *)&Option.useSlashAsFilenameSeparator, false, STAGE_ANY },
 #endif
 	{ "with-list-header", &localOption.withListHeader,  true,  STAGE_ANY },
 	{ "_fatal-warnings",&Option.fatalWarnings,          false, STAGE_ANY },
+	{ "_regex-stats",   &Option.regexStats,             false, STAGE_ANY },
 };
 
 /*
@@ -3471,11 +3639,38 @@ static void processShortOption (
 	}
 }
 
+static void updateOptionsFingerprint (const char *const item,
+									  const char *const parameter)
+{
+	/* Options not changing the tags */
+	static const char *const ignored [] = {
+		"cache", "index", "jobs", "quiet", "totals", "verbose", "V",
+		"walk-ahead",
+		"_regex-stats",
+	};
+
+	for (unsigned int i = 0; i < ARRAY_SIZE (ignored); i++)
+		if (strcmp (item, ignored [i]) == 0)
+			return;
+
+	OptionsFingerprint = OptionsFingerprint * 31 + hashCstrhash (item);
+	if (parameter)
+		OptionsFingerprint = OptionsFingerprint * 31 + hashCstrhash (parameter);
+}
+
+/* --cache uses this to know whether the tags recorded in the last run
+   were made with the same options. */
+extern unsigned int getOptionsFingerprint (void)
+{
+	return OptionsFingerprint;
+}
+
 static void parseOption (cookedArgs* const args)
 {
 	Assert (! cArgOff (args));
 	if (args->isOption)
 	{
+		updateOptionsFingerprint (args->item, args->parameter);
 		if (args->longOption)
 			processLongOption (args->item, args->parameter);
 		else
@@ -3503,30 +3698,32 @@ extern void parseCmdlineOptions (cookedArgs* const args)
 	parseOptions (args);
 }
 
-static bool checkSameFile (const char *const fileName, void * userData)
-{
-	return isSameFile ((const char* const) userData, fileName);
-}
-
 static bool parseFileOptions (const char* const fileName)
 {
 	bool fileFound = false;
 	const char* const format = "Considering option file %s: %s\n";
-	if (stringListHasTest (OptionFiles, checkSameFile, (void *) fileName))
+	char *id = fileIdentity (fileName);
+
+	if (id && hashTableHasItem (OptionFiles, id))
 	{
 		verbose (format, fileName, "already considered");
 		fileFound = true;
+		eFree (id);
 	}
 	else
 	{
 		FILE* const fp = fopen (fileName, "r");
 		if (fp == NULL)
+		{
 			verbose (format, fileName, "not found");
+			if (id)
+				eFree (id);
+		}
 		else
 		{
 			cookedArgs* const args = cArgNewFromLineFile (fp);
-			vString* file = vStringNewInit (fileName);
-			stringListAdd (OptionFiles, file);
+			if (id)
+				hashTablePutItem (OptionFiles, id, id);
 			verbose (format, fileName, "reading...");
 			parseOptions (args);
 			if (NonOptionEncountered)
@@ -3850,7 +4047,7 @@ static stringList* optlibPathListNew(struct preloadPathElt *pathList)
 
 extern void initOptions (void)
 {
-	OptionFiles = stringListNew ();
+	OptionFiles = hashTableNew (67, hashCstrhash, hashCstreq, eFree, NULL);
 	OptlibPathList = optlibPathListNew (preload_path_list);
 
 	verbose ("Setting option defaults\n");
@@ -3930,7 +4127,9 @@ extern void freeOptionResources (void)
 	freeString (&Option.tagFileName);
 	freeString (&Option.fileList);
 	freeString (&Option.filterTerminator);
+	freeString (&Option.excludeIgnoreFile);
 
+	invalidateExcludeMatchers ();
 	freeList (&Excluded);
 	freeList (&ExcludedException);
 	freeList (&Option.headerExt);
@@ -3938,7 +4137,11 @@ extern void freeOptionResources (void)
 
 	freeSearchPathList (&OptlibPathList);
 
-	freeList (&OptionFiles);
+	if (OptionFiles)
+	{
+		hashTableDelete (OptionFiles);
+		OptionFiles = NULL;
+	}
 }
 
 static void processDumpOptionsOption (const char *const option CTAGS_ATTR_UNUSED, const char *const parameter CTAGS_ATTR_UNUSED)
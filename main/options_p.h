@@ -33,6 +33,10 @@
 */
 #define includeExtensionFlags()         (Option.tagFileFormat > 1)
 
+#if defined (HAVE_FORK) && defined (HAVE_SYS_WAIT_H)
+# define JOBS_SUPPORTED
+#endif
+
 /*
 *   DATA DECLARATIONS
 */
@@ -74,6 +78,9 @@ typedef enum eTagRelative {
  */
 typedef struct sOptionValues {
 	bool append;         /* -a  append to "tags" file */
+	bool update;         /* --update  replace the tags of parsed files in "tags" file */
+	bool cache;          /* --cache  reuse the tags of unchanged files */
+	bool index;          /* --index  write the index of "tags" file */
 	bool backward;       /* -B  regexp patterns search backwards */
 	bool etags;          /* -e  output Emacs style tags file */
 	exCmd locate;           /* --excmd  EX command used to locate tag */
@@ -94,6 +101,7 @@ typedef struct sOptionValues {
 	bool followLinks;    /* --link  follow symbolic links? */
 	bool filter;         /* --filter  behave as filter: files in, tags out */
 	char* filterTerminator; /* --filter-terminator  string to output */
+	char* excludeIgnoreFile; /* --exclude-ignore-file  file of gitignore-style patterns */
 	tagRelative tagRelative;    /* --tag-relative file paths relative to tag file */
 	int  printTotals;    /* --totals  print cumulative statistics */
 	bool lineDirectives; /* --line-directives  process #line directives */
@@ -101,13 +109,17 @@ typedef struct sOptionValues {
 	bool guessLanguageEagerly; /* --guess-language-eagerly|-G */
 	bool quiet;		      /* --quiet */
 	bool fatalWarnings;	/* --_fatal-warnings */
+	bool regexStats;	/* --_regex-stats */
 	unsigned int patternLengthLimit; /* --pattern-length-limit=N */
 	bool putFieldPrefix;		 /* --put-field-prefix */
 	unsigned int maxRecursionDepth; /* --maxdepth=<max-recursion-depth> */
+	unsigned int jobs;		/* --jobs=<N> */
+	bool walkAhead;			/* --walk-ahead */
 	bool fieldsReset;				/* --fields=[^+-] */
 	enum interactiveMode { INTERACTIVE_NONE = 0,
 						   INTERACTIVE_DEFAULT,
-						   INTERACTIVE_SANDBOX, } interactive; /* --interactive */
+						   INTERACTIVE_SANDBOX,
+						   INTERACTIVE_SERVER, } interactive; /* --interactive */
 #ifdef WIN32
 	enum filenameSepOp { FILENAME_SEP_NO_REPLACE = false,
 						 FILENAME_SEP_USE_SLASH  = true,
@@ -148,6 +160,7 @@ extern const char* cArgItem (cookedArgs* const current);
 extern void cArgForth (cookedArgs* const current);
 extern bool isExcludedFile (const char* const name,
 							bool falseIfExceptionsAreDefeind);
+extern bool isExcludedDirectory (const char* const name);
 extern bool isIncludeFile (const char *const fileName);
 extern void parseCmdlineOptions (cookedArgs* const cargs);
 extern void previewFirstOption (cookedArgs* const cargs);
@@ -181,6 +194,7 @@ extern bool processPretendOption (const char *const option, const char *const pa
 extern bool processRolesOption (const char *const option, const char *const parameter);
 
 extern bool isDestinationStdout (void);
+extern unsigned int getOptionsFingerprint (void);
 
 extern void setMainLoop (mainLoopFunc func, void *data);
 
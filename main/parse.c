@@ -42,6 +42,7 @@
 #include "stats_p.h"
 #include "subparser.h"
 #include "subparser_p.h"
+#include "tagcache_p.h"
 #include "trace.h"
 #include "trashbox.h"
 #include "trashbox_p.h"
@@ -165,6 +166,36 @@ static kindDefinition defaultFileKind = {
 
 static langType ctagsSelfTestLang;
 
+/* An index from file names to the parsers that may be mapped to them.
+ * Each hash table maps a string to an intArray of the parsers in
+ * ascending order. Only the parsers found through the index are
+ * tested with their patterns and extensions. See
+ * getPatternLanguageAndSpec (). */
+static struct sLanguageMapIndex {
+	bool valid;
+	hashTable *names;		/* a pattern without wildcard */
+	hashTable *suffixes;	/* S of a pattern "*S" without other wildcards */
+	intArray *suffixLengths;
+	intArray *unindexed;	/* parsers having other patterns */
+	hashTable *extensions;
+	intArray *candidates;	/* working space */
+} LanguageMapIndex;
+
+/* The point where the next pass of a rescan parser takes over the
+ * current pass. See markRescanCheckpoint (). */
+typedef struct sRescanCheckpoint {
+	langType language;	/* LANG_IGNORE if checkpoints cannot be marked */
+	bool marked;
+	bool resuming;
+	size_t corkCount;
+	int lastPromise;
+	unsigned int anonymousIdentiferId;
+} rescanCheckpoint;
+
+static rescanCheckpoint RescanCheckpoint = {
+	.language = LANG_IGNORE,
+};
+
 /*
 *   FUNCTION DEFINITIONS
 */
@@ -466,10 +497,138 @@ extern langType getLanguageForCommand (const char *const command, langType start
 											&tmp_specType);
 }
 
+static void invalidateLanguageMapIndex (void)
+{
+	LanguageMapIndex.valid = false;
+}
+
+static void freeLanguageMapIndex (void)
+{
+	if (LanguageMapIndex.names)
+	{
+		hashTableDelete (LanguageMapIndex.names);
+		hashTableDelete (LanguageMapIndex.suffixes);
+		intArrayDelete (LanguageMapIndex.suffixLengths);
+		intArrayDelete (LanguageMapIndex.unindexed);
+		hashTableDelete (LanguageMapIndex.extensions);
+		intArrayDelete (LanguageMapIndex.candidates);
+	}
+	memset (&LanguageMapIndex, 0, sizeof (LanguageMapIndex));
+}
+
+static void indexLanguageMap (hashTable *table, const char *key, langType language)
+{
+	intArray *languages = hashTableGetItem (table, key);
+
+	if (languages == NULL)
+	{
+		languages = intArrayNew ();
+		hashTablePutItem (table, eStrdup (key), languages);
+	}
+	if (intArrayIsEmpty (languages) || intArrayLast (languages) != language)
+		intArrayAdd (languages, language);
+}
+
+static void indexLanguagePattern (const char *pattern, langType language)
+{
+	const char *wildcard = strpbrk (pattern, "*?[\\/");
+
+	if (wildcard == NULL)
+		indexLanguageMap (LanguageMapIndex.names, pattern, language);
+	else if (wildcard == pattern && *pattern == '*'
+			 && strpbrk (pattern + 1, "*?[\\/") == NULL)
+	{
+		indexLanguageMap (LanguageMapIndex.suffixes, pattern + 1, language);
+		if (!intArrayHas (LanguageMapIndex.suffixLengths, (int) strlen (pattern + 1)))
+			intArrayAdd (LanguageMapIndex.suffixLengths, (int) strlen (pattern + 1));
+	}
+	else if (intArrayIsEmpty (LanguageMapIndex.unindexed)
+			 || intArrayLast (LanguageMapIndex.unindexed) != language)
+		intArrayAdd (LanguageMapIndex.unindexed, language);
+}
+
+static void buildLanguageMapIndex (void)
+{
+#ifdef CASE_INSENSITIVE_FILENAMES
+	hashTableHashFunc hashfn = hashCstrcasehash;
+	hashTableEqualFunc equalfn = hashCstrcaseeq;
+#else
+	hashTableHashFunc hashfn = hashCstrhash;
+	hashTableEqualFunc equalfn = hashCstreq;
+#endif
+
+	freeLanguageMapIndex ();
+	LanguageMapIndex.names = hashTableNew (127, hashfn, equalfn,
+										   eFree, (hashTableDeleteFunc)intArrayDelete);
+	LanguageMapIndex.suffixes = hashTableNew (127, hashfn, equalfn,
+											  eFree, (hashTableDeleteFunc)intArrayDelete);
+	LanguageMapIndex.suffixLengths = intArrayNew ();
+	LanguageMapIndex.unindexed = intArrayNew ();
+	LanguageMapIndex.extensions = hashTableNew (509, hashfn, equalfn,
+												eFree, (hashTableDeleteFunc)intArrayDelete);
+	LanguageMapIndex.candidates = intArrayNew ();
+
+	for (unsigned int i = 0; i < LanguageCount; i++)
+	{
+		parserObject *parser = LanguageTable + i;
+
+		if (parser->currentPatterns)
+			for (unsigned int j = 0; j < stringListCount (parser->currentPatterns); j++)
+				indexLanguagePattern (vStringValue (stringListItem (parser->currentPatterns, j)), i);
+		if (parser->currentExtensions)
+			for (unsigned int j = 0; j < stringListCount (parser->currentExtensions); j++)
+				indexLanguageMap (LanguageMapIndex.extensions,
+								  vStringValue (stringListItem (parser->currentExtensions, j)), i);
+	}
+
+	LanguageMapIndex.valid = true;
+}
+
+static void addLanguageMapCandidates (const hashTable *table, const char *key)
+{
+	intArray *languages = hashTableGetItem ((hashTable *)table, key);
+
+	if (languages)
+		for (unsigned int i = 0; i < intArrayCount (languages); i++)
+			intArrayAdd (LanguageMapIndex.candidates, intArrayItem (languages, i));
+}
+
+/* Collect the parsers whose patterns may match BASENAME to
+ * LanguageMapIndex.candidates in ascending order. A parser may appear
+ * more than once. */
+static intArray *findLanguagePatternCandidates (const char *const baseName)
+{
+	const size_t length = strlen (baseName);
+	intArray *candidates = LanguageMapIndex.candidates;
+
+	intArrayClear (candidates);
+	addLanguageMapCandidates (LanguageMapIndex.names, baseName);
+	for (unsigned int i = 0; i < intArrayCount (LanguageMapIndex.suffixLengths); i++)
+	{
+		size_t l = (size_t) intArrayItem (LanguageMapIndex.suffixLengths, i);
+		if (l <= length)
+			addLanguageMapCandidates (LanguageMapIndex.suffixes, baseName + length - l);
+	}
+	for (unsigned int i = 0; i < intArrayCount (LanguageMapIndex.unindexed); i++)
+		intArrayAdd (candidates, intArrayItem (LanguageMapIndex.unindexed, i));
+	intArraySort (candidates, false);
+	return candidates;
+}
+
+static intArray *findLanguageExtensionCandidates (const char *const extension)
+{
+	intArray *candidates = LanguageMapIndex.candidates;
+
+	intArrayClear (candidates);
+	addLanguageMapCandidates (LanguageMapIndex.extensions, extension);
+	return candidates;
+}
+
 static langType getPatternLanguageAndSpec (const char *const baseName, langType start_index,
 					   const char **const spec, enum specType *specType)
 {
 	langType result = LANG_IGNORE;
+	intArray *candidates;
 	unsigned int i;
 
 	if (start_index == LANG_AUTO)
@@ -477,38 +636,45 @@ static langType getPatternLanguageAndSpec (const char *const baseName, langType
 	else if (start_index == LANG_IGNORE || start_index >= (int) LanguageCount)
 		return result;
 
+	if (!LanguageMapIndex.valid)
+		buildLanguageMapIndex ();
+
 	*spec = NULL;
-	for (i = start_index  ;  i < LanguageCount  &&  result == LANG_IGNORE  ;  ++i)
+	candidates = findLanguagePatternCandidates (baseName);
+	for (i = 0  ;  i < intArrayCount (candidates)  &&  result == LANG_IGNORE  ;  ++i)
 	{
-		if (! isLanguageEnabled (i))
+		langType lang = intArrayItem (candidates, i);
+		if (lang < start_index || ! isLanguageEnabled (lang))
 			continue;
 
-		parserObject *parser = LanguageTable + i;
+		parserObject *parser = LanguageTable + lang;
 		stringList* const ptrns = parser->currentPatterns;
 		vString* tmp;
 
 		if (ptrns != NULL && (tmp = stringListFileFinds (ptrns, baseName)))
 		{
-			result = i;
+			result = lang;
 			*spec = vStringValue(tmp);
 			*specType = SPEC_PATTERN;
 			goto found;
 		}
 	}
 
-	for (i = start_index  ;  i < LanguageCount  &&  result == LANG_IGNORE  ;  ++i)
+	candidates = findLanguageExtensionCandidates (fileExtension (baseName));
+	for (i = 0  ;  i < intArrayCount (candidates)  &&  result == LANG_IGNORE  ;  ++i)
 	{
-		if (! isLanguageEnabled (i))
+		langType lang = intArrayItem (candidates, i);
+		if (lang < start_index || ! isLanguageEnabled (lang))
 			continue;
 
-		parserObject *parser = LanguageTable + i;
+		parserObject *parser = LanguageTable + lang;
 		stringList* const exts = parser->currentExtensions;
 		vString* tmp;
 
 		if (exts != NULL && (tmp = stringListExtensionFinds (exts,
 								     fileExtension (baseName))))
 		{
-			result = i;
+			result = lang;
 			*spec = vStringValue(tmp);
 			*specType = SPEC_EXTENSION;
 			goto found;
@@ -1628,6 +1794,7 @@ extern void installLanguageMapDefault (const langType language)
 	parserObject* parser;
 	Assert (0 <= language  &&  language < (int) LanguageCount);
 	parser = LanguageTable + language;
+	invalidateLanguageMapIndex ();
 	if (parser->currentPatterns != NULL)
 		stringListDelete (parser->currentPatterns);
 	if (parser->currentExtensions != NULL)
@@ -1702,6 +1869,7 @@ extern void installLanguageAliasesDefaults (void)
 extern void clearLanguageMap (const langType language)
 {
 	Assert (0 <= language  &&  language < (int) LanguageCount);
+	invalidateLanguageMapIndex ();
 	stringListClear ((LanguageTable + language)->currentPatterns);
 	stringListClear ((LanguageTable + language)->currentExtensions);
 }
@@ -1722,6 +1890,7 @@ static bool removeLanguagePatternMap1(const langType language, const char *const
 
 	if (ptrn != NULL && stringListDeleteItemExtension (ptrn, pattern))
 	{
+		invalidateLanguageMapIndex ();
 		verbose (" (removed from %s)", getLanguageName (language));
 		result = true;
 	}
@@ -1753,6 +1922,7 @@ extern void addLanguagePatternMap (const langType language, const char* ptrn,
 	if (exclusiveInAllLanguages)
 		removeLanguagePatternMap (LANG_AUTO, ptrn);
 	stringListAdd (parser->currentPatterns, str);
+	invalidateLanguageMapIndex ();
 }
 
 static bool removeLanguageExtensionMap1 (const langType language, const char *const extension)
@@ -1762,6 +1932,7 @@ static bool removeLanguageExtensionMap1 (const langType language, const char *co
 
 	if (exts != NULL  &&  stringListDeleteItemExtension (exts, extension))
 	{
+		invalidateLanguageMapIndex ();
 		verbose (" (removed from %s)", getLanguageName (language));
 		result = true;
 	}
@@ -1792,6 +1963,7 @@ extern void addLanguageExtensionMap (
 	if (exclusiveInAllLanguages)
 		removeLanguageExtensionMap (LANG_AUTO, extension);
 	stringListAdd ((LanguageTable + language)->currentExtensions, str);
+	invalidateLanguageMapIndex ();
 }
 
 extern void addLanguageAlias (const langType language, const char* alias)
@@ -2088,6 +2260,7 @@ extern void freeParserResources (void)
 		eFree (LanguageTable);
 	LanguageTable = NULL;
 	LanguageCount = 0;
+	freeLanguageMapIndex ();
 }
 
 static void doNothing (void)
@@ -2422,6 +2595,7 @@ extern void processLanguageDefineOption (
 
 	LanguageTable [def->id].currentPatterns = stringListNew ();
 	LanguageTable [def->id].currentExtensions = stringListNew ();
+	invalidateLanguageMapIndex ();
 	LanguageTable [def->id].pretendingAsLanguage = LANG_IGNORE;
 	LanguageTable [def->id].pretendedAsLanguage = LANG_IGNORE;
 
@@ -4142,22 +4316,55 @@ extern void printParserStatisticsIfUsed (langType language)
 	}
 }
 
+extern bool markRescanCheckpoint (void)
+{
+	langType language = RescanCheckpoint.language;
+
+	RescanCheckpoint.marked = false;
+	if (language == LANG_IGNORE || getInputLanguage () != language
+		|| !markInputCheckpoint ())
+		return false;
+
+	RescanCheckpoint.marked = true;
+	RescanCheckpoint.corkCount = countEntryInCorkQueue ();
+	RescanCheckpoint.lastPromise = getLastPromise ();
+	RescanCheckpoint.anonymousIdentiferId
+		= LanguageTable [language].anonymousIdentiferId;
+	return true;
+}
+
+extern bool resumeRescanCheckpoint (void)
+{
+	if (!RescanCheckpoint.resuming)
+		return false;
+
+	RescanCheckpoint.resuming = false;
+	resumeInputCheckpoint ();
+	LanguageTable [RescanCheckpoint.language].anonymousIdentiferId
+		= RescanCheckpoint.anonymousIdentiferId;
+	return true;
+}
+
 static bool createTagsWithFallback1 (const langType language,
 									 langType *exclusive_subparser)
 {
 	bool tagFileResized = false;
 	unsigned long numTags	= numTagsAdded ();
-	MIOPos tagfpos;
+	long tagfpos = 0;
 	int lastPromise = getLastPromise ();
 	unsigned int passCount = 0;
 	rescanReason whyRescan;
 	parserObject *parser;
 	unsigned int corkFlags;
 	bool useCork = false;
+	rescanCheckpoint outerCheckpoint = RescanCheckpoint;
 
 	initializeParser (language);
 	parser = &(LanguageTable [language]);
 
+	if (Option.cache)
+		noteLanguageForCachedTags (language);
+
 	setupLanguageSubparsersInUse (language);
 
 	corkFlags = parserCorkFlags (parser->def);
@@ -4172,10 +4379,34 @@ static bool createTagsWithFallback1 (const langType language,
 
 	anonResetMaybe (parser);
 
+	/* The tags made by the line based regex patterns cannot be
+	 * taken back without undoing the state of the patterns. */
+	RescanCheckpoint.language = (useCork
+								 && !hasLanguageLineRegexPatterns (language))
+		? language
+		: LANG_IGNORE;
+	RescanCheckpoint.marked = false;
+	RescanCheckpoint.resuming = false;
+
 	while ( ( whyRescan =
 		  createTagsForFile (language, ++passCount) )
 		!= RESCAN_NONE)
 	{
+		Assert (!RescanCheckpoint.resuming);
+
+		if (whyRescan == RESCAN_FAILED && RescanCheckpoint.marked)
+		{
+			/*  Keep the tags made before the checkpoint in the cork
+			*   queue. The parser resumes the next pass from there.
+			*/
+			truncateCorkQueue (RescanCheckpoint.corkCount);
+			breakPromisesAfter (RescanCheckpoint.lastPromise);
+			RescanCheckpoint.marked = false;
+			RescanCheckpoint.resuming = true;
+			continue;
+		}
+		RescanCheckpoint.marked = false;
+
 		if (useCork)
 		{
 			uncorkTagFile();
@@ -4200,8 +4431,10 @@ static bool createTagsWithFallback1 (const langType language,
 			lastPromise = getLastPromise ();
 		}
 	}
+	Assert (!RescanCheckpoint.resuming);
+	RescanCheckpoint = outerCheckpoint;
 
-	/* Force filling allLines buffer and kick the multiline regex parser */
+	/* Force reading to EOF and kick the multiline regex parser */
 	if (hasLanguageMultilineRegexPatterns (language))
 		while (readLineFromInputFile () != NULL)
 			; /* Do nothing */
@@ -4373,6 +4606,17 @@ static void addParserPseudoTags (langType language)
 	}
 }
 
+/* Used for writing the pseudo tags of a parser without running it
+   when the tags are taken from the tag cache. */
+extern void makeParserPseudoTags (const langType language)
+{
+	Assert (0 <= language  &&  language < (int) LanguageCount);
+
+	initializeParser (language);
+	if (isXtagEnabled (XTAG_PSEUDO_TAGS))
+		addParserPseudoTags (language);
+}
+
 extern bool doesParserRequireMemoryStream (const langType language)
 {
 	Assert (0 <= language  &&  language < (int) LanguageCount);
@@ -4459,6 +4703,9 @@ extern bool parseFileWithMio (const char *const fileName, MIO *mio,
 		return tagFileResized;
 	}
 
+	if (Option.update)
+		noteReparsedInputFile (fileName);
+
 	if (language == LANG_IGNORE)
 		verbose ("ignoring %s (unknown language/language disabled)\n",
 			 fileName);
@@ -4507,31 +4754,32 @@ extern bool parseRawBuffer(const char *fileName, unsigned char *buffer,
 }
 
 static void matchLanguageMultilineRegexCommon (const langType language,
-											   bool (* func) (struct lregexControlBlock *, const vString* const),
-											   const vString* const allLines)
+											   bool (* func) (struct lregexControlBlock *,
+															  const char *const, const size_t),
+											   const char *const input, const size_t length)
 {
 	subparser *tmp;
 
-	func ((LanguageTable + language)->lregexControlBlock, allLines);
+	func ((LanguageTable + language)->lregexControlBlock, input, length);
 	foreachSubparser(tmp, true)
 	{
 		langType t = getSubparserLanguage (tmp);
 		enterSubparser (tmp);
-		matchLanguageMultilineRegexCommon (t, func, allLines);
+		matchLanguageMultilineRegexCommon (t, func, input, length);
 		leaveSubparser ();
 	}
 }
 
 extern void matchLanguageMultilineRegex (const langType language,
-										 const vString* const allLines)
+										 const char *const input, const size_t length)
 {
-	matchLanguageMultilineRegexCommon(language, matchMultilineRegex, allLines);
+	matchLanguageMultilineRegexCommon(language, matchMultilineRegex, input, length);
 }
 
 extern void matchLanguageMultitableRegex (const langType language,
-										  const vString* const allLines)
+										  const char *const input, const size_t length)
 {
-	matchLanguageMultilineRegexCommon(language, matchMultitableRegex, allLines);
+	matchLanguageMultilineRegexCommon(language, matchMultitableRegex, input, length);
 }
 
 extern void processLanguageMultitableExtendingOption (langType language, const char *const parameter)
@@ -4585,6 +4833,11 @@ extern bool hasLanguageMultilineRegexPatterns (const langType language)
 	return lregexQueryParserAndSubparsers (language, regexNeedsMultilineBuffer);
 }
 
+extern bool hasLanguageLineRegexPatterns (const langType language)
+{
+	return lregexQueryParserAndSubparsers (language, regexHasLinePatterns);
+}
+
 
 extern void addLanguageCallbackRegex (const langType language, const char *const regex, const char *const flags,
 									  const regexCallback callback, bool *disabled, void *userData)
@@ -5314,6 +5567,14 @@ extern void printLanguageMultitableStatistics (langType language)
 	printMultitableStatistics (parser->lregexControlBlock);
 }
 
+extern void printRegexStatisticsIfUsed (langType language)
+{
+	parserObject* const parser = LanguageTable + language;
+
+	if (parser->used)
+		printRegexStatistics (parser->lregexControlBlock);
+}
+
 extern void addLanguageRegexTable (const langType language, const char *name)
 {
 	parserObject* const parser = LanguageTable + language;
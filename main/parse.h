@@ -201,6 +201,18 @@ extern void addLanguageTagMultiTableRegex(const langType language,
 
 extern void addLanguageOptscriptToHook (langType language, enum scriptHook hook, const char *const src);
 
+/* A rescan parser may mark the points in a pass where the next pass
+ * can take over: until the point, the next pass would read the input
+ * and make tags in the same way as the current pass. When the current
+ * pass returns RESCAN_FAILED, the tags made after the last point
+ * marked are dropped, and resumeRescanCheckpoint () at the beginning
+ * of the next pass moves the input to the point and returns true. The
+ * parser must restore its own state at the point then.
+ * markRescanCheckpoint () returns false if the point cannot be marked.
+ * The point marked before is forgotten then. */
+extern bool markRescanCheckpoint (void);
+extern bool resumeRescanCheckpoint (void);
+
 extern void anonGenerate (vString *buffer, const char *prefix, int kind);
 extern void anonConcat   (vString *buffer, int kind);
 extern vString *anonGenerateNew (const char *prefix, int kind);
@@ -122,6 +122,7 @@ extern void printLanguageSubparsers (const langType language,
 									 bool withListHeader, bool machinable, FILE *fp);
 extern void printLangdefFlags (bool withListHeader, bool machinable, FILE *fp);
 extern void printKinddefFlags (bool withListHeader, bool machinable, FILE *fp);
+extern void makeParserPseudoTags (const langType language);
 extern bool doesParserRequireMemoryStream (const langType language);
 extern bool parseFile (const char *const fileName);
 extern bool parseFileWithMio (const char *const fileName, MIO *mio, void *clientData);
@@ -156,8 +157,12 @@ extern bool doesLanguageExpectCorkInRegex (const langType language);
 
 /* Multiline Regex Interface */
 extern bool hasLanguageMultilineRegexPatterns (const langType language);
-extern void matchLanguageMultilineRegex (const langType language, const vString* const allLines);
-extern void matchLanguageMultitableRegex (const langType language, const vString* const allLines);
+extern bool hasLanguageLineRegexPatterns (const langType language);
+extern bool doesMultilineRegexNeedTerminatedInput (void);
+extern void matchLanguageMultilineRegex (const langType language,
+										 const char *const input, const size_t length);
+extern void matchLanguageMultitableRegex (const langType language,
+										  const char *const input, const size_t length);
 
 extern void processLanguageMultitableExtendingOption (langType language, const char *const parameter);
 
@@ -180,6 +185,7 @@ extern bool makeParserVersionPseudoTags (const langType language,
 										 const ptagDesc *pdesc);
 
 extern void printLanguageMultitableStatistics (langType language);
+extern void printRegexStatisticsIfUsed (langType language);
 extern void printParserStatisticsIfUsed (langType lang);
 
 /* For keeping the API compatibility with Geany, we use a macro here. */
@@ -0,0 +1,417 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for matching file names against the
+*   patterns of --exclude and --exclude-exception, and against the
+*   patterns in gitignore-style exclude files (--exclude-ignore-file).
+*
+*   A pathMatcher sorts the patterns into names without wildcards,
+*   "P*" prefixes, "*S" suffixes and the others. The first three kinds
+*   are looked up in hash tables; only the others are tried with
+*   fnmatch ().
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <fnmatch.h>
+#include <string.h>
+
+#include "debug.h"
+#include "htable.h"
+#include "mio.h"
+#include "numarray.h"
+#include "pathmatch_p.h"
+#include "ptrarray.h"
+#include "read.h"
+#include "routines.h"
+#include "strlist.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define WILDCARD_CHARS "*?[\\"
+
+/*
+*   DATA DECLARATIONS
+*/
+struct sPathMatcher {
+	hashTable *names;
+	hashTable *prefixes;
+	hashTable *suffixes;
+	intArray *prefixLengths;
+	intArray *suffixLengths;
+	stringList *globs;
+	stringList *all;
+	stringList *openEnded;	/* ending with "*" */
+	vString *scratch;
+};
+
+typedef struct sIgnoreRule {
+	char *pattern;
+	bool negated;
+	bool directoryOnly;
+	bool anchored;		/* matched against the relative path, not the base name */
+	bool recursive;		/* has "**" */
+} ignoreRule;
+
+struct sIgnoreRules {
+	ptrArray *rules;
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static hashTable *newPatternTable (void)
+{
+#ifdef CASE_INSENSITIVE_FILENAMES
+	return hashTableNew (31, hashCstrcasehash, hashCstrcaseeq, eFree, NULL);
+#else
+	return hashTableNew (31, hashCstrhash, hashCstreq, eFree, NULL);
+#endif
+}
+
+static void addPattern (hashTable *table, intArray *lengths, const char *const str, size_t length)
+{
+	char *key = eStrndup (str, length);
+
+	if (hashTableHasItem (table, key))
+		eFree (key);
+	else
+		hashTablePutItem (table, key, key);
+
+	if (lengths && !intArrayHas (lengths, (int) length))
+		intArrayAdd (lengths, (int) length);
+}
+
+extern pathMatcher *pathMatcherNew (const stringList *const patterns)
+{
+	pathMatcher *m = xMalloc (1, pathMatcher);
+
+	m->names = newPatternTable ();
+	m->prefixes = newPatternTable ();
+	m->suffixes = newPatternTable ();
+	m->prefixLengths = intArrayNew ();
+	m->suffixLengths = intArrayNew ();
+	m->globs = stringListNew ();
+	m->all = stringListNew ();
+	m->openEnded = stringListNew ();
+	m->scratch = vStringNew ();
+
+	for (unsigned int i = 0; patterns && i < stringListCount (patterns); i++)
+	{
+		const vString *const vpattern = stringListItem (patterns, i);
+		const char *const pattern = vStringValue (vpattern);
+		const size_t length = vStringLength (vpattern);
+		const size_t literal = strcspn (pattern, WILDCARD_CHARS);
+
+		if (literal == length)
+			addPattern (m->names, NULL, pattern, length);
+		else if (literal == length - 1 && pattern [literal] == '*')
+			addPattern (m->prefixes, m->prefixLengths, pattern, literal);
+		else if (literal == 0 && pattern [0] == '*'
+				 && strpbrk (pattern + 1, WILDCARD_CHARS) == NULL)
+			addPattern (m->suffixes, m->suffixLengths, pattern + 1, length - 1);
+		else
+			stringListAdd (m->globs, vStringNewCopy (vpattern));
+		stringListAdd (m->all, vStringNewCopy (vpattern));
+		if (length > 0 && pattern [length - 1] == '*'
+			&& !(length > 1 && pattern [length - 2] == '\\'))
+			stringListAdd (m->openEnded, vStringNewCopy (vpattern));
+	}
+
+	return m;
+}
+
+extern void pathMatcherDelete (pathMatcher *m)
+{
+	hashTableDelete (m->names);
+	hashTableDelete (m->prefixes);
+	hashTableDelete (m->suffixes);
+	intArrayDelete (m->prefixLengths);
+	intArrayDelete (m->suffixLengths);
+	stringListDelete (m->globs);
+	stringListDelete (m->all);
+	stringListDelete (m->openEnded);
+	vStringDelete (m->scratch);
+	eFree (m);
+}
+
+extern bool pathMatcherMatch (pathMatcher *m, const char *const fileName)
+{
+	const char *name = fileName;
+	size_t length = strlen (fileName);
+	unsigned int i;
+
+#if defined (WIN32)
+	vStringCopyS (m->scratch, fileName);
+	vStringTranslate (m->scratch, PATH_SEPARATOR, OUTPUT_PATH_SEPARATOR);
+	name = eStrdup (vStringValue (m->scratch));
+#endif
+
+	bool matched = hashTableHasItem (m->names, name);
+
+	for (i = 0; !matched && i < intArrayCount (m->suffixLengths); i++)
+	{
+		size_t l = (size_t) intArrayItem (m->suffixLengths, i);
+		if (l <= length)
+			matched = hashTableHasItem (m->suffixes, name + length - l);
+	}
+
+	for (i = 0; !matched && i < intArrayCount (m->prefixLengths); i++)
+	{
+		size_t l = (size_t) intArrayItem (m->prefixLengths, i);
+		if (l <= length)
+		{
+			vStringNCopyS (m->scratch, name, l);
+			matched = hashTableHasItem (m->prefixes, vStringValue (m->scratch));
+		}
+	}
+
+	if (!matched && stringListCount (m->globs) > 0)
+		matched = stringListFileMatched (m->globs, name);
+
+#if defined (WIN32)
+	eFree ((char *)name);
+#endif
+	return matched;
+}
+
+static vString *newDirectoryPrefix (const char *const dirName)
+{
+	vString *dir = vStringNewInit (dirName);
+
+#if defined (WIN32)
+	vStringTranslate (dir, PATH_SEPARATOR, OUTPUT_PATH_SEPARATOR);
+#endif
+	if (vStringIsEmpty (dir) || vStringLast (dir) != OUTPUT_PATH_SEPARATOR)
+		vStringPut (dir, OUTPUT_PATH_SEPARATOR);
+	return dir;
+}
+
+extern bool pathMatcherMatchesAllUnder (const pathMatcher *m, const char *const dirName)
+{
+	bool result = false;
+
+	/* If a pattern ending with "*" matches "DIR/", the last "*" can
+	 * match the rest of any path under DIR. */
+	if (stringListCount (m->openEnded) > 0)
+	{
+		vString *dir = newDirectoryPrefix (dirName);
+		result = stringListFileMatched (m->openEnded, vStringValue (dir));
+		vStringDelete (dir);
+	}
+	return result;
+}
+
+extern bool pathMatcherMayMatchUnder (const pathMatcher *m, const char *const dirName)
+{
+	vString *dir = newDirectoryPrefix (dirName);
+	bool result = false;
+
+	for (unsigned int i = 0; !result && i < stringListCount (m->all); i++)
+	{
+		const char *const pattern = vStringValue (stringListItem (m->all, i));
+		size_t literal = strcspn (pattern, WILDCARD_CHARS);
+
+		/* A pattern without a separator can match the base name of
+		 * any file. A bracket expression can match a separator. */
+		if (strchr (pattern, OUTPUT_PATH_SEPARATOR) == NULL
+			|| strchr (pattern, '[') != NULL)
+			result = true;
+		else
+		{
+			if (literal > vStringLength (dir))
+				literal = vStringLength (dir);
+#ifdef CASE_INSENSITIVE_FILENAMES
+			result = (strncasecmp (pattern, vStringValue (dir), literal) == 0);
+#else
+			result = (strncmp (pattern, vStringValue (dir), literal) == 0);
+#endif
+		}
+	}
+
+	vStringDelete (dir);
+	return result;
+}
+
+static ignoreRule *ignoreRuleNew (const char *line)
+{
+	vString *pattern = vStringNewInit (line);
+	ignoreRule *rule;
+	bool negated = false;
+	bool directoryOnly = false;
+
+	/* Trailing spaces are ignored unless they are quoted with backslash. */
+	while (vStringLength (pattern) > 0 && vStringLast (pattern) == ' '
+		   && !(vStringLength (pattern) > 1
+				&& vStringChar (pattern, vStringLength (pattern) - 2) == '\\'))
+		vStringChop (pattern);
+
+	if (vStringIsEmpty (pattern) || vStringChar (pattern, 0) == '#')
+	{
+		vStringDelete (pattern);
+		return NULL;
+	}
+
+	if (vStringChar (pattern, 0) == '!')
+	{
+		negated = true;
+		memmove (vStringValue (pattern), vStringValue (pattern) + 1,
+				 vStringLength (pattern));
+		vStringSetLength (pattern);
+	}
+	else if (vStringChar (pattern, 0) == '\\'
+			 && (vStringChar (pattern, 1) == '!' || vStringChar (pattern, 1) == '#'))
+	{
+		memmove (vStringValue (pattern), vStringValue (pattern) + 1,
+				 vStringLength (pattern));
+		vStringSetLength (pattern);
+	}
+
+	if (vStringLength (pattern) > 0 && vStringLast (pattern) == '/')
+	{
+		directoryOnly = true;
+		vStringChop (pattern);
+	}
+
+	if (vStringIsEmpty (pattern))
+	{
+		vStringDelete (pattern);
+		return NULL;
+	}
+
+	rule = xMalloc (1, ignoreRule);
+	rule->negated = negated;
+	rule->directoryOnly = directoryOnly;
+	rule->anchored = (strchr (vStringValue (pattern), '/') != NULL);
+	rule->recursive = (strstr (vStringValue (pattern), "**") != NULL);
+	rule->pattern = eStrdup (vStringValue (pattern)
+							 + (vStringChar (pattern, 0) == '/'? 1: 0));
+	vStringDelete (pattern);
+	return rule;
+}
+
+static void ignoreRuleDelete (void *data)
+{
+	ignoreRule *rule = data;
+
+	eFree (rule->pattern);
+	eFree (rule);
+}
+
+extern ignoreRules *ignoreRulesNew (const char *const fileName)
+{
+	MIO *mio = mio_new_file (fileName, "rb");
+	vString *vLine;
+	const char *line;
+	ignoreRules *r;
+
+	if (mio == NULL)
+		return NULL;
+
+	r = xMalloc (1, ignoreRules);
+	r->rules = ptrArrayNew (ignoreRuleDelete);
+
+	vLine = vStringNew ();
+	while ((line = readLineRaw (vLine, mio)) != NULL)
+	{
+		vStringStripNewline (vLine);
+		if (vStringLength (vLine) > 0 && vStringLast (vLine) == '\r')
+			vStringChop (vLine);
+
+		ignoreRule *rule = ignoreRuleNew (vStringValue (vLine));
+		if (rule)
+			ptrArrayAdd (r->rules, rule);
+	}
+	vStringDelete (vLine);
+	mio_unref (mio);
+
+	return r;
+}
+
+extern void ignoreRulesDelete (ignoreRules *r)
+{
+	ptrArrayDelete (r->rules);
+	eFree (r);
+}
+
+static bool matchSegment (const char *pattern, size_t patternLength,
+						  const char *path, size_t pathLength)
+{
+	char *p = eStrndup (pattern, patternLength);
+	char *s = eStrndup (path, pathLength);
+	bool r = (fnmatch (p, s, 0) == 0);
+
+	eFree (s);
+	eFree (p);
+	return r;
+}
+
+/* Match PATTERN against PATH segment by segment. A "**" segment
+ * matches zero or more segments. */
+static bool matchSegments (const char *pattern, const char *path)
+{
+	if (pattern [0] == '*' && pattern [1] == '*'
+		&& (pattern [2] == '/' || pattern [2] == '\0'))
+	{
+		if (pattern [2] == '\0')
+			return true;
+		for (const char *p = path; ; p++)
+		{
+			if (matchSegments (pattern + 3, p))
+				return true;
+			p = strchr (p, '/');
+			if (p == NULL)
+				return false;
+		}
+	}
+
+	const char *patternEnd = strchr (pattern, '/');
+	const char *pathEnd = strchr (path, '/');
+	size_t patternLength = patternEnd? (size_t) (patternEnd - pattern): strlen (pattern);
+	size_t pathLength = pathEnd? (size_t) (pathEnd - path): strlen (path);
+
+	if (!matchSegment (pattern, patternLength, path, pathLength))
+		return false;
+	if (patternEnd == NULL || pathEnd == NULL)
+		return patternEnd == NULL && pathEnd == NULL;
+	return matchSegments (patternEnd + 1, pathEnd + 1);
+}
+
+static bool ignoreRuleMatch (const ignoreRule *rule, const char *const relPath,
+							 bool isDirectory)
+{
+	if (rule->directoryOnly && !isDirectory)
+		return false;
+
+	if (!rule->anchored)
+	{
+		const char *base = strrchr (relPath, '/');
+		return fnmatch (rule->pattern, base? base + 1: relPath, 0) == 0;
+	}
+	else if (rule->recursive)
+		return matchSegments (rule->pattern, relPath);
+	else
+		return fnmatch (rule->pattern, relPath, FNM_PATHNAME) == 0;
+}
+
+extern int ignoreRulesMatch (const ignoreRules *r, const char *const relPath,
+							 bool isDirectory)
+{
+	/* The last matching pattern decides. */
+	for (unsigned int i = ptrArrayCount (r->rules); i > 0; i--)
+	{
+		const ignoreRule *rule = ptrArrayItem (r->rules, i - 1);
+		if (ignoreRuleMatch (rule, relPath, isDirectory))
+			return rule->negated? -1: 1;
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines internal interface to the matchers of file names used for
+*   excluding input files.
+*/
+#ifndef CTAGS_MAIN_PATHMATCH_PRIVATE_H
+#define CTAGS_MAIN_PATHMATCH_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "strlist.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+struct sPathMatcher;
+typedef struct sPathMatcher pathMatcher;
+
+struct sIgnoreRules;
+typedef struct sIgnoreRules ignoreRules;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* A pathMatcher is a compiled form of a list of shell wildcard patterns.
+ * pathMatcherMatch () returns the same as stringListFileMatched () for
+ * the list. pathMatcherMayMatchUnder () returns false if no pattern can
+ * match a path under DIRNAME or the base name of a file in it.
+ * pathMatcherMatchesAllUnder () returns true if a pattern matches all
+ * the paths under DIRNAME. */
+extern pathMatcher *pathMatcherNew (const stringList *const patterns);
+extern void pathMatcherDelete (pathMatcher *m);
+extern bool pathMatcherMatch (pathMatcher *m, const char *const fileName);
+extern bool pathMatcherMayMatchUnder (const pathMatcher *m, const char *const dirName);
+extern bool pathMatcherMatchesAllUnder (const pathMatcher *m, const char *const dirName);
+
+/* ignoreRules are the patterns in a gitignore-style exclude file.
+ * ignoreRulesNew () returns NULL if FILENAME cannot be read.
+ * ignoreRulesMatch () returns 1 if RELPATH, a path relative to the
+ * directory of the file, is excluded, -1 if it is included again with
+ * a "!" pattern, and 0 if no pattern matches it. */
+extern ignoreRules *ignoreRulesNew (const char *const fileName);
+extern void ignoreRulesDelete (ignoreRules *r);
+extern int ignoreRulesMatch (const ignoreRules *r, const char *const relPath,
+							 bool isDirectory);
+
+#endif  /* CTAGS_MAIN_PATHMATCH_PRIVATE_H */
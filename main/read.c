@@ -75,6 +75,9 @@ typedef struct sInputLineFposMap {
 	compoundPos *pos;
 	unsigned int count;
 	unsigned int size;
+	/* The number of entries built in advance by buildLineFposMap ().
+	 * Only the first COUNT entries, the lines read so far, are used. */
+	unsigned int built;
 } inputLineFposMap;
 
 typedef struct sNestedInputStreamInfo {
@@ -111,7 +114,8 @@ typedef struct sInputFile {
 	   in sourceTagPathHolder are destroyed. */
 	stringList  * sourceTagPathHolder;
 	inputLineFposMap lineFposMap;
-	vString *allLines;
+	bool multilineRegexPending;	/* run the multiline regex parsers at EOF */
+	vString *allLines;	/* NULL if they can run on the buffer of mio */
 	int thinDepth;
 	time_t mtime;
 } inputFile;
@@ -137,6 +141,17 @@ static inputFile File;  /* static read through functions */
 static inputFile BackupFile;	/* File is copied here when a nested parser is pushed */
 static compoundPos StartOfLine;  /* holds deferred position of start of line */
 
+/* Where markInputCheckpoint () was called last */
+static struct sInputCheckpoint {
+	compoundPos filePosition;
+	compoundPos startOfLine;
+	long column;	/* -1 if no line is being worked on */
+	unsigned long inputLineNumber;
+	unsigned long sourceLineNumber;
+	unsigned int lineCount;	/* of lineFposMap */
+	bool multilineRegexPending;
+} InputCheckpoint;
+
 /*
 *   FUNCTION DEFINITIONS
 */
@@ -334,6 +349,7 @@ static void allocLineFposMap (inputLineFposMap *lineFposMap)
 	lineFposMap->pos = xCalloc (INITIAL_lineFposMap_LEN, compoundPos);
 	lineFposMap->size = INITIAL_lineFposMap_LEN;
 	lineFposMap->count = 0;
+	lineFposMap->built = 0;
 }
 
 static void appendLineFposMap (inputLineFposMap *lineFposMap, compoundPos *pos,
@@ -362,6 +378,71 @@ static void appendLineFposMap (inputLineFposMap *lineFposMap, compoundPos *pos,
 	lineFposMap->count++;
 }
 
+/* Build the map for all the lines of a memory stream in one pass with
+ * memchr () instead of appending an entry each time a line is read.
+ * The lines must be split as readLine () splits them. readLine ()
+ * joins a line having a NUL byte with the next line; for such an input,
+ * the map is built with appendLineFposMap () as the lines are read. */
+static bool buildLineFposMap (inputLineFposMap *lineFposMap, MIO *mio, bool bomFound)
+{
+	size_t size;
+	const unsigned char *data = mio_memory_get_data (mio, &size);
+	size_t start = bomFound? 3: 0;
+	int crAdjustment = 0;
+	unsigned int built = 0;
+
+	if (data == NULL || start > size
+		|| memchr (data + start, '\0', size - start))
+		return false;
+
+	while (start < size)
+	{
+		const unsigned char *nl = memchr (data + start, '\n', size - start);
+		size_t end = nl? (size_t) (nl - data): size;
+
+		if (nl && end > start && data [end - 1] == '\r')
+			crAdjustment++;
+
+		if (lineFposMap->size == built)
+		{
+			lineFposMap->size *= 2;
+			lineFposMap->pos = xRealloc (lineFposMap->pos,
+										 lineFposMap->size,
+										 compoundPos);
+		}
+
+		compoundPos *pos = lineFposMap->pos + built++;
+		mio_memory_getpos_at (mio, start, &pos->pos);
+		pos->offset = (long) start;
+		pos->open = false;
+		pos->crAdjustment = crAdjustment;
+
+		start = end + 1;
+	}
+
+	lineFposMap->built = built;
+	return true;
+}
+
+/* Use the entry built in advance for the INDEXth line instead of
+ * appending one. A line may be read again after resetInputFile (). */
+static bool advanceLineFposMap (inputLineFposMap *lineFposMap, unsigned int index,
+								compoundPos *pos)
+{
+	if (index >= lineFposMap->built)
+		return false;
+
+	Assert (lineFposMap->pos [index].offset == pos->offset);
+	if (index < lineFposMap->count)
+		return true;
+
+	if (lineFposMap->count != 0)
+		lineFposMap->pos [lineFposMap->count - 1].open = false;
+	lineFposMap->pos [index].open = true;
+	lineFposMap->count = index + 1;
+	return true;
+}
+
 static int compoundPosForOffset (const void* oft, const void *p)
 {
 	long offset = *(long *)oft;
@@ -414,6 +495,23 @@ static void setOwnerDirectoryOfInputFile (const char *const fileName)
 	}
 }
 
+/*  Returns the file name as written in the tag file for the input file
+ *  FILENAME.
+ */
+extern vString *getTagPathForFile (const char *const fileName)
+{
+	if (  Option.tagRelative == TREL_ALWAYS )
+		return vStringNewOwn (relativeFilename (fileName,
+												getTagFileDirectory ()));
+	else if ( Option.tagRelative == TREL_NEVER )
+		return vStringNewOwn (absoluteFilename (fileName));
+	else if ( Option.tagRelative == TREL_NO || isAbsolutePath (fileName) )
+		return vStringNewInit (fileName);
+	else
+		return vStringNewOwn (relativeFilename (fileName,
+												getTagFileDirectory ()));
+}
+
 static void setInputFileParametersCommon (inputFileInfo *finfo, vString *const fileName,
 					  const langType language,
 					  stringList *holder)
@@ -430,21 +528,7 @@ static void setInputFileParametersCommon (inputFileInfo *finfo, vString *const f
 			vStringDelete (finfo->tagPath);
 	}
 
-	if (0)
-		;
-	else if (  Option.tagRelative == TREL_ALWAYS )
-		finfo->tagPath =
-			vStringNewOwn (relativeFilename (vStringValue (fileName),
-							 getTagFileDirectory ()));
-	else if ( Option.tagRelative == TREL_NEVER )
-		finfo->tagPath =
-			vStringNewOwn (absoluteFilename (vStringValue (fileName)));
-	else if ( Option.tagRelative == TREL_NO || isAbsolutePath (vStringValue (fileName)) )
-		finfo->tagPath = vStringNewCopy (fileName);
-	else
-		finfo->tagPath =
-			vStringNewOwn (relativeFilename (vStringValue (fileName),
-							 getTagFileDirectory ()));
+	finfo->tagPath = getTagPathForFile (vStringValue (fileName));
 
 	finfo->isHeader = isIncludeFile (vStringValue (fileName));
 }
@@ -628,6 +712,18 @@ static bool parseLineDirective (char *s)
 #define MAX_IN_MEMORY_FILE_SIZE (1024*1024)
 #endif
 
+/*  Whether input files larger than MAX_IN_MEMORY_FILE_SIZE are mapped into
+ *  memory instead of being read through stdio. The program enabling it
+ *  must handle SIGBUS raised when such a file is truncated while it is
+ *  read; see mio_new_mmap ().
+ */
+static bool InputFileMapping = false;
+
+extern void enableInputFileMapping (void)
+{
+	InputFileMapping = true;
+}
+
 static MIO *getMioFull (const char *const fileName, const char *const openMode,
 		    bool memStreamRequired, time_t *mtime)
 {
@@ -641,6 +737,17 @@ static MIO *getMioFull (const char *const fileName, const char *const openMode,
 	if (mtime)
 		*mtime = st->mtime;
 	eStatFree (st);
+
+	/* Map a large file into memory instead of reading it through
+	   stdio. A small file is copied to a buffer below. */
+	if (InputFileMapping && size > MAX_IN_MEMORY_FILE_SIZE
+		&& strcmp (openMode, "rb") == 0)
+	{
+		MIO *mio = mio_new_mmap (fileName);
+		if (mio)
+			return mio;
+	}
+
 	if ((!memStreamRequired)
 	    && (size > MAX_IN_MEMORY_FILE_SIZE || size == 0))
 		return mio_new_file (fileName, openMode);
@@ -769,6 +876,7 @@ extern bool openInputFile (const char *const fileName, const langType language,
 		File.source.lineNumberOrigin = 0L;
 		File.source.lineNumber = File.source.lineNumberOrigin;
 		allocLineFposMap (&File.lineFposMap);
+		buildLineFposMap (&File.lineFposMap, File.mio, File.bomFound);
 
 		File.thinDepth = 0;
 		verbose ("OPENING%s %s as %s language %sfile [%s%s]\n",
@@ -787,6 +895,45 @@ extern time_t getInputFileMtime (void)
 	return File.mtime;
 }
 
+/* The multiline regex parsers can run directly on the buffer of a
+ * memory stream if the buffer is the same as the concatenation of
+ * the lines read with readLine (): no CR-LF to be turned into LF,
+ * and no NUL byte at which a line is truncated. The buffer is not
+ * terminated with '\0', so the regex backends must honor the length.
+ * Otherwise, the lines must be copied to File.allLines. */
+static const char *getMultilineRegexInput (size_t *length)
+{
+	size_t size;
+	const char *data;
+
+	if (doesMultilineRegexNeedTerminatedInput ())
+		return NULL;
+
+	data = (const char *) mio_memory_get_data (File.mio, &size);
+	if (data == NULL)
+		return NULL;
+
+	if (File.bomFound)
+	{
+		data += 3;
+		size -= 3;
+	}
+
+	if (memchr (data, '\0', size))
+		return NULL;
+
+	for (const char *cr = memchr (data, '\r', size);
+		 cr != NULL;
+		 cr = memchr (cr + 1, '\r', size - (cr + 1 - data)))
+	{
+		if (cr + 1 < data + size && cr [1] == '\n')
+			return NULL;
+	}
+
+	*length = size;
+	return data;
+}
+
 extern void resetInputFile (const langType language)
 {
 	Assert (File.mio);
@@ -801,8 +948,13 @@ extern void resetInputFile (const langType language)
 	vStringClear (File.line);
 	File.ungetchIdx = 0;
 
-	if (hasLanguageMultilineRegexPatterns (language))
-		File.allLines = vStringNew ();
+	File.multilineRegexPending = hasLanguageMultilineRegexPatterns (language);
+	if (File.multilineRegexPending)
+	{
+		size_t length;
+		if (getMultilineRegexInput (&length) == NULL)
+			File.allLines = vStringNew ();
+	}
 
 	resetLangOnStack (& inputLang, language);
 	File.input.lineNumber = File.input.lineNumberOrigin;
@@ -817,9 +969,10 @@ extern void closeInputFile (void)
 		clearLangOnStack (& inputLang);
 
 		/*  The line count of the file is 1 too big, since it is one-based
-		 *  and is incremented upon each newline.
+		 *  and is incremented upon each newline. --cache records the
+		 *  totals for later runs with --totals.
 		 */
-		if (Option.printTotals)
+		if (Option.printTotals || Option.cache)
 		{
 			fileStatus *status = eStat (vStringValue (File.input.name));
 			addTotals (0, File.input.lineNumber - 1L, status->size);
@@ -841,7 +994,9 @@ static void fileNewline (bool crAdjustment)
 {
 	File.filePosition = StartOfLine;
 
-	if (BackupFile.mio == NULL)
+	if (BackupFile.mio == NULL
+		&& !advanceLineFposMap (&File.lineFposMap, File.input.lineNumber,
+								&File.filePosition))
 		appendLineFposMap (&File.lineFposMap, &File.filePosition,
 						   crAdjustment);
 
@@ -916,6 +1071,61 @@ static eolType readLine (vString *const vLine, MIO *const mio)
 	return r;
 }
 
+/* A line is read again when resuming in the middle of it, so the
+ * checkpoint is refused if reading a line has side effects which cannot
+ * be undone: #line directives, and collecting lines for the multiline
+ * regex parsers. */
+extern bool markInputCheckpoint (void)
+{
+	if (BackupFile.mio != NULL || Option.lineDirectives
+		|| File.allLines != NULL || File.ungetchIdx > 0)
+		return false;
+
+	InputCheckpoint.filePosition = File.filePosition;
+	InputCheckpoint.startOfLine = StartOfLine;
+	InputCheckpoint.column = File.currentLine
+		? (long) (File.currentLine - (unsigned char *) vStringValue (File.line))
+		: -1;
+	InputCheckpoint.inputLineNumber = File.input.lineNumber;
+	InputCheckpoint.sourceLineNumber = File.source.lineNumber;
+	InputCheckpoint.lineCount = File.lineFposMap.count;
+	InputCheckpoint.multilineRegexPending = File.multilineRegexPending;
+	return true;
+}
+
+extern void resumeInputCheckpoint (void)
+{
+	File.filePosition = InputCheckpoint.filePosition;
+	StartOfLine = InputCheckpoint.startOfLine;
+	File.ungetchIdx = 0;
+
+	if (InputCheckpoint.column < 0)
+	{
+		mio_setpos (File.mio, &StartOfLine.pos);
+		File.currentLine = NULL;
+	}
+	else
+	{
+		/* The line was matched against the regex patterns when it was
+		 * read first. */
+		mio_setpos (File.mio, &File.filePosition.pos);
+		readLine (File.line, File.mio);
+		Assert (InputCheckpoint.column <= (long) vStringLength (File.line));
+		File.currentLine = (unsigned char *) vStringValue (File.line)
+			+ InputCheckpoint.column;
+	}
+
+	File.input.lineNumber = InputCheckpoint.inputLineNumber;
+	File.source.lineNumber = InputCheckpoint.sourceLineNumber;
+	if (File.lineFposMap.count > InputCheckpoint.lineCount)
+	{
+		File.lineFposMap.count = InputCheckpoint.lineCount;
+		if (File.lineFposMap.count > 0)
+			File.lineFposMap.pos [File.lineFposMap.count - 1].open = true;
+	}
+	File.multilineRegexPending = InputCheckpoint.multilineRegexPending;
+}
+
 static vString *iFileGetLine (bool chop_newline)
 {
 	eolType eol;
@@ -949,15 +1159,30 @@ static vString *iFileGetLine (bool chop_newline)
 	}
 	else
 	{
-		if (File.allLines)
+		if (File.multilineRegexPending)
 		{
-			matchLanguageMultilineRegex (lang, File.allLines);
-			matchLanguageMultitableRegex (lang, File.allLines);
+			const char *input;
+			size_t length;
+
+			if (File.allLines)
+			{
+				input = vStringValue (File.allLines);
+				length = vStringLength (File.allLines);
+			}
+			else
+				input = getMultilineRegexInput (&length);
+
+			matchLanguageMultilineRegex (lang, input, length);
+			matchLanguageMultitableRegex (lang, input, length);
 
 			/* To limit the execution of multiline/multitable parser(s) only
-			   ONCE, clear File.allLines field. */
-			vStringDelete (File.allLines);
-			File.allLines = NULL;
+			   ONCE, clear File.multilineRegexPending field. */
+			File.multilineRegexPending = false;
+			if (File.allLines)
+			{
+				vStringDelete (File.allLines);
+				File.allLines = NULL;
+			}
 		}
 		return NULL;
 	}
@@ -1073,6 +1298,36 @@ extern char *readLineRaw (vString *const vLine, MIO *const mio)
 	return vStringLength (vLine) > 0 ? vStringValue (vLine) : NULL;
 }
 
+/*  Returns the line at "location" in the buffer of the input stream
+ *  without seeking or reading the stream. The line is not terminated with
+ *  '\0'; its length, including the newline, is stored to "length".
+ *  Returns NULL if the line cannot be taken as readLineFromBypass () would
+ *  read it: the stream is not a memory stream, the input is converted, or
+ *  the line has a NUL byte.
+ */
+extern const char *getInputLineAtPosition (MIOPos location, size_t *length)
+{
+	size_t size;
+	const char *line;
+
+#ifdef HAVE_ICONV
+	if (isConverting ())
+		return NULL;
+#endif
+
+	line = (const char *) mio_memory_get_data_at (File.mio, &location, &size);
+	if (line == NULL || size == 0)
+		return NULL;
+
+	const char *nl = memchr (line, '\n', size);
+	size_t len = nl? (size_t) (nl - line) + 1: size;
+	if (memchr (line, '\0', len))
+		return NULL;
+
+	*length = len;
+	return line;
+}
+
 /*  Places into the line buffer the contents of the line referenced by
  *  "location".
  */
@@ -33,6 +33,7 @@ enum nestedInputBoundaryFlag {
 
 extern const char *getInputLanguageName (void);
 extern const char *getInputFileTagPath (void);
+extern vString *getTagPathForFile (const char *const fileName);
 
 extern long getInputFileOffsetForLine (unsigned int line);
 
@@ -47,6 +48,7 @@ extern langType getLanguageForBaseParser (void);
 
 extern bool isParserMarkedNoEmission (void);
 extern void freeInputFileResources (void);
+extern void enableInputFileMapping (void);
 
 /* Stream opened by getMio can be passed to openInputFile as the 3rd
    argument. If the 3rd argument is NULL, openInputFile calls getMio
@@ -56,6 +58,11 @@ extern bool openInputFile (const char *const fileName, const langType language,
 extern MIO *getMio (const char *const fileName, const char *const openMode,
 				    bool memStreamRequired);
 extern void resetInputFile (const langType language);
+/* Record the position of the input, and go back to the position.
+ * markInputCheckpoint () returns false if the position cannot be
+ * restored. */
+extern bool markInputCheckpoint (void);
+extern void resumeInputCheckpoint (void);
 extern void closeInputFile (void);
 extern void *getInputFileUserData(void);
 
@@ -66,8 +73,10 @@ extern langType getSourceLanguage (void);
 
 extern time_t getInputFileMtime (void);
 
+
 /* Bypass: reading from fp in inputFile WITHOUT updating fields in input fields */
 extern char *readLineFromBypass (vString *const vLine, MIOPos location, long *const pSeekValue);
+extern const char *getInputLineAtPosition (MIOPos location, size_t *length);
 extern void   pushNarrowedInputStream (
 				       bool useMemoryStreamInput,
 				       unsigned long startLine, long startCharOffset,
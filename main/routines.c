@@ -593,6 +593,36 @@ extern bool isSameFile (const char *const name1, const char *const name2)
 	return result;
 }
 
+/* Return a newly allocated string identifying the file NAME refers to,
+ * or NULL if the file doesn't exist. Two names refer to the same file
+ * if their identities are equal; keeping the identities in a hash table
+ * avoids calling isSameFile () against every file seen before. */
+extern char *fileIdentity (const char *const name)
+{
+#if defined (HAVE_STAT_ST_INO)
+	struct stat st;
+	char buf [2 * 3 * sizeof (unsigned long long) + 2];
+
+	if (stat (name, &st) != 0)
+		return NULL;
+	snprintf (buf, sizeof buf, "%llx:%llx",
+			  (unsigned long long) st.st_dev, (unsigned long long) st.st_ino);
+	return eStrdup (buf);
+#else
+	char *id;
+
+	if (! doesFileExist (name))
+		return NULL;
+	id = absoluteFilename (name);
+	canonicalizePath (id);
+# if defined (CASE_INSENSITIVE_FILENAMES)
+	for (char *p = id; *p; p++)
+		*p = (char) tolower ((unsigned char) *p);
+# endif
+	return id;
+#endif
+}
+
 extern const char *baseFilename (const char *const filePath)
 {
 #if defined (MSDOS_STYLE_PATH)
@@ -89,6 +89,7 @@ extern bool doesFileExist (const char *const fileName);
 extern bool doesExecutableExist (const char *const fileName);
 extern bool isRecursiveLink (const char* const dirName);
 extern bool isSameFile (const char *const name1, const char *const name2);
+extern char *fileIdentity (const char *const name);
 extern bool isAbsolutePath (const char *const path);
 extern char *combinePathAndFile (const char *const path, const char *const file);
 extern char* absoluteFilename (const char *file);
@@ -26,6 +26,8 @@
 #include "debug.h"
 #include "entry_p.h"
 #include "options_p.h"
+#include "ptag_p.h"
+#include "ptrarray.h"
 #include "read.h"
 #include "routines.h"
 #include "sort_p.h"
@@ -34,18 +36,167 @@
 *   FUNCTION DEFINITIONS
 */
 
+typedef int (* sortCompareFunc) (const void *, const void *);
+
 extern void catFile (MIO *mio)
 {
 	if (mio != NULL)
 	{
-		int c;
-		mio_seek (mio, 0, SEEK_SET);
-		while ((c = mio_getc (mio)) != EOF)
-			putchar (c);
+		size_t size;
+		const unsigned char *const data = mio_memory_get_data (mio, &size);
+
+		if (data)
+			fwrite (data, 1, size, stdout);
+		else
+		{
+			int c;
+			mio_seek (mio, 0, SEEK_SET);
+			while ((c = mio_getc (mio)) != EOF)
+				putchar (c);
+		}
 		fflush (stdout);
 	}
 }
 
+extern void failedSort (MIO *const mio, const char* msg)
+{
+	const char* const cannotSort = "cannot sort tag file";
+	if (mio != NULL)
+		mio_unref (mio);
+	if (msg == NULL)
+		error (FATAL | PERROR, "%s", cannotSort);
+	else
+		error (FATAL, "%s: %s", msg, cannotSort);
+}
+
+static int compareTagsFolded(const void *const one, const void *const two)
+{
+	const char *const line1 = *(const char* const*) one;
+	const char *const line2 = *(const char* const*) two;
+
+	return struppercmp (line1, line2);
+}
+
+static int compareTags (const void *const one, const void *const two)
+{
+	const char *const line1 = *(const char* const*) one;
+	const char *const line2 = *(const char* const*) two;
+
+	return strcmp (line1, line2);
+}
+
+static int compareTagLines (const char *const line1, const char *const line2)
+{
+	if (Option.sorted == SO_FOLDSORTED)
+		return struppercmp (line1, line2);
+	else
+		return strcmp (line1, line2);
+}
+
+static MIO *openSortedTagFile (const bool toStdout)
+{
+	MIO *mio;
+
+	if (toStdout)
+		mio = mio_new_fp (stdout, NULL);
+	else
+	{
+		mio = mio_new_file (tagFileName (), "w");
+		if (mio == NULL)
+			failedSort (mio, NULL);
+	}
+	return mio;
+}
+
+static void closeSortedTagFile (MIO *const mio, const bool toStdout)
+{
+	if (toStdout)
+		mio_flush (mio);
+	mio_unref (mio);
+}
+
+static void writeSortedTag (MIO *const mio, const char *const line,
+							const char *const previous, bool newlineReplaced)
+{
+	/*  Here we filter out identical tag *lines* (including search
+	 *  pattern) if this is not an xref file. With --sort=foldcase, lines
+	 *  differing only in case are identical as for "sort -u -f".
+	 */
+	if (previous == NULL  ||  Option.xref  ||  compareTagLines (line, previous) != 0)
+	{
+		if (mio_puts (mio, line) == EOF)
+			failedSort (mio, NULL);
+		else if (newlineReplaced)
+			mio_putc (mio, '\n');
+	}
+}
+
+static void writeSortedTags (
+		char **const table, const size_t numTags, MIO *const mio, bool newlineReplaced)
+{
+	size_t i;
+
+	for (i = 0 ; i < numTags ; ++i)
+		writeSortedTag (mio, table [i], i == 0? NULL: table [i-1], newlineReplaced);
+}
+
+/*
+ *  This function sorts the tags written to a memory stream. The lines are
+ *  sorted where they are, and written to stdout without going through a
+ *  temporary file.
+ */
+extern void memorySortTags (MIO *const mio)
+{
+	char **table = NULL;
+	size_t tableSize = 0;
+	size_t numTags = 0;
+	size_t size;
+	char *data;
+
+	/*  Terminate the last line so that every line ends with a newline.
+	 */
+	data = (char *) mio_memory_get_data (mio, &size);
+	if (data == NULL)
+		failedSort (NULL, "not a memory stream");
+	if (size > 0 && data [size - 1] != '\n')
+	{
+		mio_seek (mio, 0, SEEK_END);
+		if (mio_putc (mio, '\n') == EOF)
+			failedSort (NULL, "out of memory");
+		data = (char *) mio_memory_get_data (mio, &size);
+	}
+
+	/*  Split the lines in place and collect them.
+	 */
+	char *const end = data + size;
+	for (char *line = data; line < end; )
+	{
+		char *const eol = memchr (line, '\n', end - line);
+		*eol = '\0';
+		if (*line != '\0')  /* ignore blank lines */
+		{
+			if (numTags == tableSize)
+			{
+				tableSize = tableSize == 0? 1024: tableSize * 2;
+				table = xRealloc (table, tableSize, char *);
+			}
+			table [numTags++] = line;
+		}
+		line = eol + 1;
+	}
+
+	qsort (table, numTags, sizeof (*table),
+		   Option.sorted == SO_FOLDSORTED ? compareTagsFolded : compareTags);
+
+	MIO *output = openSortedTagFile (true);
+	writeSortedTags (table, numTags, output, true);
+	closeSortedTagFile (output, true);
+
+	PrintStatus (("sort memory: %ld bytes\n", (long) (tableSize * sizeof (char *))));
+	if (table)
+		eFree (table);
+}
+
 #ifdef EXTERNAL_SORT
 
 #ifdef NON_CONST_PUTENV_PROTOTYPE
@@ -172,90 +323,215 @@ extern void externalSortTags (const bool toStdout, MIO *tagFile)
 #else
 
 /*
- *  These functions provide a basic internal sort. No great memory
- *  optimization is performed (e.g. recursive subdivided sorts),
- *  so have lots of memory if you have large tag files.
+ *  These functions provide a basic internal sort. The lines of the tag
+ *  file are sorted in runs using at most SORT_RUN_SIZE bytes of memory.
+ *  If the tag file doesn't fit in a single run, each sorted run is
+ *  written to a temporary file, and the runs are merged at the end.
  */
 
-extern void failedSort (MIO *const mio, const char* msg)
+#ifdef DEBUG
+#define SORT_CHUNK_SIZE 256
+#define SORT_RUN_SIZE (16*1024)
+#else
+#define SORT_CHUNK_SIZE (1024*1024)
+#define SORT_RUN_SIZE (64*1024*1024)
+#endif
+
+typedef struct sSortRun {
+	ptrArray *chunks;	/* buffers storing the lines */
+	char *chunk;		/* the last item of chunks */
+	size_t chunkUsed;
+	size_t chunkSize;
+	char **table;		/* line pointers to be sorted */
+	size_t count;
+	size_t tableSize;
+	size_t memorySize;	/* chunks and table */
+} sortRun;
+
+typedef struct sSpilledRun {
+	MIO *mio;
+	char *name;
+	vString *line;		/* the line at the head of the run */
+	unsigned int index;
+} spilledRun;
+
+/* Store a copy of LINE to RUN. Return false if RUN has no room for it. */
+static bool addSortRunLine (sortRun *const run, const char *const line, const size_t length)
 {
-	const char* const cannotSort = "cannot sort tag file";
-	if (mio != NULL)
-		mio_unref (mio);
-	if (msg == NULL)
-		error (FATAL | PERROR, "%s", cannotSort);
-	else
-		error (FATAL, "%s: %s", msg, cannotSort);
+	if (run->count == run->tableSize)
+	{
+		const size_t tableSize = run->tableSize == 0? 64: run->tableSize * 2;
+		const size_t growth = (tableSize - run->tableSize) * sizeof (char *);
+
+		if (run->count > 0  &&  run->memorySize + growth > SORT_RUN_SIZE)
+			return false;
+		run->table = xRealloc (run->table, tableSize, char *);
+		run->tableSize = tableSize;
+		run->memorySize += growth;
+	}
+
+	if (run->chunkUsed + length + 1 > run->chunkSize)
+	{
+		const size_t chunkSize = length + 1 > SORT_CHUNK_SIZE? length + 1: SORT_CHUNK_SIZE;
+
+		if (run->count > 0  &&  run->memorySize + chunkSize > SORT_RUN_SIZE)
+			return false;
+		run->chunk = xMalloc (chunkSize, char);
+		ptrArrayAdd (run->chunks, run->chunk);
+		run->chunkUsed = 0;
+		run->chunkSize = chunkSize;
+		run->memorySize += chunkSize;
+	}
+
+	char *const copy = run->chunk + run->chunkUsed;
+	memcpy (copy, line, length);
+	copy [length] = '\0';
+	run->chunkUsed += length + 1;
+	run->table [run->count++] = copy;
+	return true;
 }
 
-static int compareTagsFolded(const void *const one, const void *const two)
+static void clearSortRun (sortRun *const run)
 {
-	const char *const line1 = *(const char* const*) one;
-	const char *const line2 = *(const char* const*) two;
+	ptrArrayClear (run->chunks);
+	run->chunk = NULL;
+	run->chunkUsed = 0;
+	run->chunkSize = 0;
+	run->count = 0;
+	run->memorySize = run->tableSize * sizeof (char *);
+}
 
-	return struppercmp (line1, line2);
+static void spillSortRun (sortRun *const run, ptrArray *const spilled,
+						  sortCompareFunc cmpFunc)
+{
+	spilledRun *const spill = xMalloc (1, spilledRun);
+
+	spill->name = NULL;
+	spill->mio = tempFile ("w+", &spill->name);
+	spill->line = vStringNew ();
+	spill->index = ptrArrayCount (spilled);
+	ptrArrayAdd (spilled, spill);
+
+	verbose ("spilling %lu sorted lines to %s\n",
+			 (unsigned long) run->count, spill->name);
+	qsort (run->table, run->count, sizeof (*run->table), cmpFunc);
+	writeSortedTags (run->table, run->count, spill->mio, true);
+	clearSortRun (run);
 }
 
-static int compareTags (const void *const one, const void *const two)
+static void deleteSpilledRun (void *data)
 {
-	const char *const line1 = *(const char* const*) one;
-	const char *const line2 = *(const char* const*) two;
+	spilledRun *const spill = data;
 
-	return strcmp (line1, line2);
+	mio_unref (spill->mio);
+	remove (spill->name);
+	eFree (spill->name);
+	vStringDelete (spill->line);
+	eFree (spill);
 }
 
-static void writeSortedTags (
-		char **const table, const size_t numTags, const bool toStdout, bool newlineReplaced)
+static bool readSpilledRun (spilledRun *const spill)
 {
-	MIO *mio;
+	if (readLineRaw (spill->line, spill->mio) == NULL)
+		return false;
+	vStringStripNewline (spill->line);
+	return true;
+}
+
+/* Runs holding the same line are ordered by their creation to keep
+ * the order that a single sort of the whole tag file would make. */
+static int compareSpilledRuns (const spilledRun *const one, const spilledRun *const two,
+							   sortCompareFunc cmpFunc)
+{
+	const char *const line1 = vStringValue (one->line);
+	const char *const line2 = vStringValue (two->line);
+	const int r = cmpFunc (&line1, &line2);
+
+	if (r != 0)
+		return r;
+	return (one->index < two->index)? -1: 1;
+}
+
+static void siftDownSpilledRuns (spilledRun **const heap, const size_t count, size_t i,
+								 sortCompareFunc cmpFunc)
+{
+	for (;;)
+	{
+		size_t least = i;
+		const size_t left = 2 * i + 1;
+		const size_t right = left + 1;
+
+		if (left < count  &&  compareSpilledRuns (heap [left], heap [least], cmpFunc) < 0)
+			least = left;
+		if (right < count  &&  compareSpilledRuns (heap [right], heap [least], cmpFunc) < 0)
+			least = right;
+		if (least == i)
+			break;
+
+		spilledRun *const tmp = heap [i];
+		heap [i] = heap [least];
+		heap [least] = tmp;
+		i = least;
+	}
+}
+
+/* Merge the sorted runs in SPILLED into MIO with a heap. */
+static void mergeSpilledRuns (ptrArray *const spilled, MIO *const mio,
+							  bool newlineReplaced, sortCompareFunc cmpFunc)
+{
+	spilledRun **const heap = xMalloc (ptrArrayCount (spilled), spilledRun *);
+	vString *previous = vStringNew ();
+	bool first = true;
+	size_t count = 0;
 	size_t i;
 
-	/*  Write the sorted lines back into the tag file.
-	 */
-	if (toStdout)
-		mio = mio_new_fp (stdout, NULL);
-	else
+	for (i = 0; i < ptrArrayCount (spilled); i++)
 	{
-		mio = mio_new_file (tagFileName (), "w");
-		if (mio == NULL)
+		spilledRun *const spill = ptrArrayItem (spilled, i);
+
+		if (mio_seek (spill->mio, 0, SEEK_SET) != 0)
 			failedSort (mio, NULL);
+		if (readSpilledRun (spill))
+			heap [count++] = spill;
 	}
-	for (i = 0 ; i < numTags ; ++i)
+	for (i = count / 2; i > 0; i--)
+		siftDownSpilledRuns (heap, count, i - 1, cmpFunc);
+
+	while (count > 0)
 	{
-		/*  Here we filter out identical tag *lines* (including search
-		 *  pattern) if this is not an xref file.
-		 */
-		if (i == 0  ||  Option.xref  ||  strcmp (table [i], table [i-1]) != 0)
-		{
-			if (mio_puts (mio, table [i]) == EOF)
-				failedSort (mio, NULL);
-			else if (newlineReplaced)
-				mio_putc (mio, '\n');
-		}
+		spilledRun *const spill = heap [0];
+		vString *const tmp = previous;
+
+		writeSortedTag (mio, vStringValue (spill->line),
+						first? NULL: vStringValue (previous), newlineReplaced);
+		first = false;
+
+		/* Reuse the buffer of the line written previously. */
+		previous = spill->line;
+		spill->line = tmp;
+		if (! readSpilledRun (spill))
+			heap [0] = heap [--count];
+		siftDownSpilledRuns (heap, count, 0, cmpFunc);
 	}
-	if (toStdout)
-		mio_flush (mio);
-	mio_unref (mio);
+
+	vStringDelete (previous);
+	eFree (heap);
 }
 
 extern void internalSortTags (const bool toStdout, MIO* mio, size_t numTags)
 {
 	vString *vLine = vStringNew ();
+	ptrArray *spilled = ptrArrayNew (deleteSpilledRun);
+	sortRun run = {
+		.chunks = ptrArrayNew (eFree),
+	};
 	const char *line;
 	size_t i;
-	int (*cmpFunc)(const void *, const void *);
+	sortCompareFunc cmpFunc;
 	bool newlineReplaced = false;
-
-	/*  Allocate a table of line pointers to be sorted.
-	 */
-	const size_t tableSize = numTags * sizeof (char *);
-	char **table = (char **) malloc (tableSize);  /* line pointers */
-	DebugStatement ( size_t mallocSize = tableSize; )  /* cumulative total */
-
+	DebugStatement ( size_t maxMemorySize = 0; )
 
 	cmpFunc = Option.sorted == SO_FOLDSORTED ? compareTagsFolded : compareTags;
-	if (table == NULL)
-		failedSort (mio, "out of memory");
 
 	for (i = 0  ;  i < numTags  &&  ! mio_eof (mio)  ;  )
 	{
@@ -270,34 +546,197 @@ extern void internalSortTags (const bool toStdout, MIO* mio, size_t numTags)
 			;  /* ignore blank lines */
 		else
 		{
-			const size_t stringSize = strlen (line) + 1;
-
-			table [i] = (char *) malloc (stringSize);
-			if (table [i] == NULL)
-				failedSort (mio, "out of memory");
-			DebugStatement ( mallocSize += stringSize; )
-			strcpy (table [i], line);
-			if (table[i][stringSize - 2] == '\n')
+			size_t length = vStringLength (vLine);
+
+			if (line [length - 1] == '\n')
 			{
-				table[i][stringSize - 2] = '\0';
+				--length;
 				newlineReplaced = true;
 			}
+			if (! addSortRunLine (&run, line, length))
+			{
+				DebugStatement ( if (run.memorySize > maxMemorySize) maxMemorySize = run.memorySize; )
+				spillSortRun (&run, spilled, cmpFunc);
+				addSortRunLine (&run, line, length);
+			}
 			++i;
 		}
 	}
-	numTags = i;
 	vStringDelete (vLine);
+	DebugStatement ( if (run.memorySize > maxMemorySize) maxMemorySize = run.memorySize; )
 
 	/*  Sort the lines.
 	 */
-	qsort (table, numTags, sizeof (*table), cmpFunc);
+	if (ptrArrayCount (spilled) == 0)
+	{
+		qsort (run.table, run.count, sizeof (*run.table), cmpFunc);
 
-	writeSortedTags (table, numTags, toStdout, newlineReplaced);
+		MIO *output = openSortedTagFile (toStdout);
+		writeSortedTags (run.table, run.count, output, newlineReplaced);
+		closeSortedTagFile (output, toStdout);
+	}
+	else
+	{
+		if (run.count > 0)
+			spillSortRun (&run, spilled, cmpFunc);
 
-	PrintStatus (("sort memory: %ld bytes\n", (long) mallocSize));
-	for (i = 0 ; i < numTags ; ++i)
-		free (table [i]);
-	free (table);
+		MIO *output = openSortedTagFile (toStdout);
+		mergeSpilledRuns (spilled, output, newlineReplaced, cmpFunc);
+		closeSortedTagFile (output, toStdout);
+	}
+
+	PrintStatus (("sort memory: %ld bytes\n", (long) maxMemorySize));
+	ptrArrayDelete (spilled);
+	ptrArrayDelete (run.chunks);
+	if (run.table)
+		eFree (run.table);
+}
+#endif
+
+/*
+ *  These functions merge the tags generated in this run into an existing
+ *  sorted tag file (--update). The lines of the existing tag file are
+ *  streamed once; only the new tags are held in memory.
+ */
+
+static int compareTagLineItems (const void *const one, const void *const two)
+{
+	return compareTagLines (one, two);
 }
 
+static bool isPseudoTagLine (const char *const line)
+{
+	return strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0;
+}
+
+/* Store the NTH (0 origin) tab separated field of LINE to FIELD. */
+static bool getTagLineField (const char *const line, unsigned int nth, vString *const field)
+{
+	const char *start = line;
+
+	for (; nth > 0; nth--)
+	{
+		start = strchr (start, '\t');
+		if (start == NULL)
+			return false;
+		start++;
+	}
+
+	const char *const end = strchr (start, '\t');
+	if (end == NULL)
+		return false;
+
+	vStringNCopyS (field, start, end - start);
+	return true;
+}
+
+static char *readTagLine (vString *const vLine, MIO *const mio)
+{
+	char *line;
+
+	do
+	{
+		line = readLineRaw (vLine, mio);
+		if (line == NULL)
+			return NULL;
+		vStringStripNewline (vLine);
+	}
+	while (vStringIsEmpty (vLine));
+
+	return vStringValue (vLine);
+}
+
+static void writeUniqTagLine (MIO *const mio, const char *const line,
+							  vString *const previous, const char *const outputName)
+{
+	if (!vStringIsEmpty (previous) && compareTagLines (vStringValue (previous), line) == 0)
+		return;
+
+	if (mio_puts (mio, line) == EOF || mio_putc (mio, '\n') == EOF)
+		error (FATAL | PERROR, "cannot write tag file: %s", outputName);
+	vStringCopyS (previous, line);
+}
+
+extern unsigned long updateSortedTags (MIO *const newTags, const char *const tagFileName,
+									   hashTable *const reparsedInputs)
+{
+	ptrArray *table = ptrArrayNew (eFree);
+	hashTable *pseudoTagNames = hashTableNew (31, hashCstrhash, hashCstreq, eFree, NULL);
+	vString *vLine = vStringNew ();
+	vString *field = vStringNew ();
+	vString *previous = vStringNew ();
+	unsigned long kept = 0;
+	const char *line;
+
+	/*  Load and sort the tags generated in this run.
+	 */
+	mio_seek (newTags, 0, SEEK_SET);
+	while ((line = readTagLine (vLine, newTags)) != NULL)
+	{
+		ptrArrayAdd (table, vStringStrdup (vLine));
+		if (isPseudoTagLine (line)
+			&& getTagLineField (line, 0, field)
+			&& !hashTableHasItem (pseudoTagNames, vStringValue (field)))
+			hashTablePutItem (pseudoTagNames, vStringStrdup (field), pseudoTagNames);
+	}
+	ptrArraySort (table, compareTagLineItems);
+
+	MIO *const oldTags = mio_new_file (tagFileName, "r");
+	if (oldTags == NULL)
+		error (FATAL | PERROR, "cannot open tag file for updating: %s", tagFileName);
+
+	vString *outputName = vStringNewInit (tagFileName);
+	vStringCatS (outputName, ".update");
+	MIO *const output = mio_new_file (vStringValue (outputName), "w");
+	if (output == NULL)
+		error (FATAL | PERROR, "cannot open temporary tag file: %s",
+			   vStringValue (outputName));
+
+	/*  Merge the new tags with the lines of the existing tag file, dropping
+	 *  the lines for the input files parsed in this run and the pseudo tags
+	 *  written again in this run.
+	 */
+	unsigned int n = 0;
+	const unsigned int count = ptrArrayCount (table);
+	while ((line = readTagLine (vLine, oldTags)) != NULL)
+	{
+		if (isPseudoTagLine (line))
+		{
+			if (getTagLineField (line, 0, field)
+				&& hashTableHasItem (pseudoTagNames, vStringValue (field)))
+				continue;
+		}
+		else if (getTagLineField (line, 1, field)
+				 && hashTableHasItem (reparsedInputs, vStringValue (field)))
+			continue;
+
+		for (; n < count && compareTagLines (ptrArrayItem (table, n), line) <= 0; n++)
+			writeUniqTagLine (output, ptrArrayItem (table, n), previous,
+							  vStringValue (outputName));
+		writeUniqTagLine (output, line, previous, vStringValue (outputName));
+		kept++;
+	}
+	for (; n < count; n++)
+		writeUniqTagLine (output, ptrArrayItem (table, n), previous,
+						  vStringValue (outputName));
+
+	mio_unref (oldTags);
+	if (mio_unref (output) != 0)
+		error (FATAL | PERROR, "cannot close temporary tag file: %s",
+			   vStringValue (outputName));
+
+#ifdef WIN32
+	remove (tagFileName);
 #endif
+	if (rename (vStringValue (outputName), tagFileName) != 0)
+		error (FATAL | PERROR, "cannot replace tag file: %s", tagFileName);
+
+	vStringDelete (outputName);
+	vStringDelete (previous);
+	vStringDelete (field);
+	vStringDelete (vLine);
+	hashTableDelete (pseudoTagNames);
+	ptrArrayDelete (table);
+
+	return kept;
+}
@@ -16,6 +16,7 @@
 
 #include <stdio.h>
 
+#include "htable.h"
 #include "mio.h"
 
 /*
@@ -23,6 +24,10 @@
 */
 extern void catFile (MIO *mio);
 
+/* Sort the lines in MIO, a memory stream, and write them to stdout.
+ * The content of MIO is broken. */
+extern void memorySortTags (MIO *const mio);
+
 #ifdef EXTERNAL_SORT
 extern void externalSortTags (const bool toStdout, MIO *tagFile);
 #else
@@ -31,6 +36,12 @@ extern void internalSortTags (const bool toStdout,
 			      size_t numTags);
 #endif
 
+/* Merge NEWTAGS into the sorted tag file named TAGFILENAME, dropping the
+ * existing lines for the input files in REPARSEDINPUTS. Returns the number
+ * of lines kept from the existing tag file. */
+extern unsigned long updateSortedTags (MIO *const newTags, const char *const tagFileName,
+									   hashTable *const reparsedInputs);
+
 /* mio is closed in this function. */
 extern void failedSort (MIO *const mio, const char* msg);
 
@@ -30,6 +30,7 @@
 *   DATA DEFINITIONS
 */
 static struct { long files, lines, bytes; } Totals = { 0, 0, 0 };
+static struct corkTotals CorkTotals = { 0, 0, 0, 0 };
 
 
 /*
@@ -44,6 +45,28 @@ extern void addTotals (
 	Totals.bytes += bytes;
 }
 
+extern void getTotals (long *files, long *lines, long *bytes)
+{
+	*files = Totals.files;
+	*lines = Totals.lines;
+	*bytes = Totals.bytes;
+}
+
+extern void addCorkTotals (
+		const unsigned long entries, const unsigned long savedAllocations,
+		const unsigned long internedStrings, const unsigned long arenaBytes)
+{
+	CorkTotals.entries += entries;
+	CorkTotals.savedAllocations += savedAllocations;
+	CorkTotals.internedStrings += internedStrings;
+	CorkTotals.arenaBytes += arenaBytes;
+}
+
+extern void getCorkTotals (struct corkTotals *totals)
+{
+	*totals = CorkTotals;
+}
+
 extern void printTotals (const clock_t *const timeStamps, bool append, sortType sorted)
 {
 	const unsigned long totalTags = numTagsTotal();
@@ -70,6 +93,14 @@ extern void printTotals (const clock_t *const timeStamps, bool append, sortType
 		fprintf (stderr, " (now %lu tags)", totalTags);
 	fputc ('\n', stderr);
 
+	if (CorkTotals.entries > 0)
+		fprintf (stderr, "%lu tag%s queued in %lu kB of arena"
+				 " (%lu allocation%s saved, %lu by interning)\n",
+				 CorkTotals.entries, plural (CorkTotals.entries),
+				 CorkTotals.arenaBytes/1024L,
+				 CorkTotals.savedAllocations, plural (CorkTotals.savedAllocations),
+				 CorkTotals.internedStrings);
+
 	if (totalTags > 0  &&  sorted != SO_UNSORTED)
 	{
 		fprintf (stderr, "%lu tag%s sorted", totalTags, plural (totalTags));
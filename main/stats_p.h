@@ -19,10 +19,26 @@
 #include "general.h"  /* must always come first */
 #include "options_p.h"
 
+/*
+*   DATA DECLARATIONS
+*/
+
+/* How the cork queue entries were allocated. See uncorkTagFile (). */
+struct corkTotals {
+	unsigned long entries;
+	unsigned long savedAllocations;
+	unsigned long internedStrings;
+	unsigned long arenaBytes;
+};
+
 /*
 *   FUNCTION PROTOTYPES
 */
 extern void addTotals (const unsigned int files, const long unsigned int lines, const long unsigned int bytes);
+extern void getTotals (long *files, long *lines, long *bytes);
+extern void addCorkTotals (const unsigned long entries, const unsigned long savedAllocations,
+						   const unsigned long internedStrings, const unsigned long arenaBytes);
+extern void getCorkTotals (struct corkTotals *totals);
 extern void printTotals (const clock_t *const timeStamps, bool append, sortType sorted);
 
 #endif  /* CTAGS_MAIN_STATS_PRIVATE_H */
@@ -0,0 +1,511 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for reusing the tags of input files
+*   which are unchanged since the last run (--cache).
+*
+*   The tag lines emitted for each input file are recorded in a sidecar
+*   file, "<tagfile>.cache", together with the size and the modification
+*   time of the input file. When an input file has the same size and
+*   modification time in the next run, its recorded tag lines are copied
+*   to the tag file without opening and parsing the input file.
+*
+*   The sidecar file starts with a header line:
+*
+*	!_CTAGS_CACHE<TAB><time><TAB><fingerprint>
+*
+*   <time> is when the run writing the file started. An input file
+*   modified at or after <time> may have been modified again within the
+*   same second, so its record is never trusted. <fingerprint> identifies
+*   the version of ctags, the options, and the working directory; the
+*   whole file is ignored if it differs from the current one.
+*
+*   A record follows the header for each input file:
+*
+*	<size> <mtime> <files> <lines> <bytes> <tags> <length> <languages> <name>
+*
+*   and <length> bytes of tag lines. <files>, <lines>, and <bytes> are for
+*   --totals. <languages> is a comma separated list of the parsers run on
+*   the input file, or "-" if none ran; their pseudo tags are written
+*   again when the record is used. Pseudo tags are not recorded.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ctags.h"
+#include "debug.h"
+#include "entry_p.h"
+#include "htable.h"
+#include "mio.h"
+#include "options_p.h"
+#include "parse_p.h"
+#include "read.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "stats_p.h"
+#include "tagcache_p.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define TAG_CACHE_FORMAT 1
+#define TAG_CACHE_MAGIC "!_CTAGS_CACHE\t"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sCachedInput {
+	unsigned long size;
+	time_t mtime;
+	long files, lines, bytes;
+	unsigned long tags;
+	long offset;				/* of the tag lines in the old cache file */
+	unsigned long length;
+	char *languages;
+} cachedInput;
+
+typedef struct sTagCache {
+	char *name;
+	char *tempName;
+	vString *fingerprint;
+	unsigned int optionsFingerprint;
+	bool disabled;
+
+	/* The cache file written in the last run */
+	MIO *oldMio;
+	hashTable *oldInputs;
+	time_t oldTime;
+
+	/* The cache file written in this run */
+	MIO *newMio;
+
+	/* The input file being parsed */
+	struct sCurrentInput {
+		bool active;
+		char *fileName;
+		unsigned long size;
+		time_t mtime;
+		long offset;			/* in the tag file */
+		long files, lines, bytes;
+		vString *languages;
+	} current;
+} tagCache;
+
+/*
+*   DATA DEFINITIONS
+*/
+static tagCache TagCache = {
+	.name = NULL,
+	.tempName = NULL,
+	.fingerprint = NULL,
+	.disabled = true,
+	.oldMio = NULL,
+	.oldInputs = NULL,
+	.newMio = NULL,
+	.current = {
+		.active = false,
+		.fileName = NULL,
+		.languages = NULL,
+	},
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deleteCachedInput (void *data)
+{
+	cachedInput *c = data;
+
+	eFree (c->languages);
+	eFree (c);
+}
+
+static vString *makeFingerprint (void)
+{
+	vString *fingerprint = vStringNew ();
+	char buf[32];
+
+	vStringCatS (fingerprint, PROGRAM_VERSION);
+	snprintf (buf, sizeof (buf), " %d %08x ", TAG_CACHE_FORMAT,
+			  TagCache.optionsFingerprint);
+	vStringCatS (fingerprint, buf);
+	vStringCatS (fingerprint, CurrentDirectory);
+
+	return fingerprint;
+}
+
+static bool readCacheHeader (MIO *const mio, vString *const vLine)
+{
+	const size_t magicLength = strlen (TAG_CACHE_MAGIC);
+	unsigned long long t;
+	char *p;
+
+	if (readLineRaw (vLine, mio) == NULL)
+		return false;
+	vStringStripNewline (vLine);
+
+	p = vStringValue (vLine);
+	if (strncmp (p, TAG_CACHE_MAGIC, magicLength) != 0)
+		return false;
+	p += magicLength;
+
+	t = strtoull (p, &p, 10);
+	if (*p != '\t')
+		return false;
+	if (strcmp (p + 1, vStringValue (TagCache.fingerprint)) != 0)
+		return false;
+
+	TagCache.oldTime = (time_t) t;
+	return true;
+}
+
+static bool readCacheRecords (MIO *const mio, vString *const vLine)
+{
+	while (readLineRaw (vLine, mio) != NULL)
+	{
+		cachedInput c;
+		long long mtime;
+		int langStart = -1, langEnd = -1, nameStart = -1;
+
+		vStringStripNewline (vLine);
+		if (sscanf (vStringValue (vLine), "%lu %lld %ld %ld %ld %lu %lu %n%*s%n %n",
+					&c.size, &mtime, &c.files, &c.lines, &c.bytes,
+					&c.tags, &c.length,
+					&langStart, &langEnd, &nameStart) < 7
+			|| nameStart < 0)
+			return false;
+
+		c.mtime = (time_t) mtime;
+		c.offset = mio_tell (mio);
+		if (mio_seek (mio, (long) c.length, SEEK_CUR) != 0)
+			return false;
+
+		const char *const name = vStringValue (vLine) + nameStart;
+		if (hashTableHasItem (TagCache.oldInputs, name))
+			continue;
+
+		cachedInput *item = xMalloc (1, cachedInput);
+		*item = c;
+		item->languages = eStrndup (vStringValue (vLine) + langStart,
+									langEnd - langStart);
+		hashTablePutItem (TagCache.oldInputs, eStrdup (name), item);
+	}
+
+	return true;
+}
+
+static void loadOldTagCache (void)
+{
+	vString *vLine;
+
+	TagCache.oldMio = mio_new_file (TagCache.name, "rb");
+	if (TagCache.oldMio == NULL)
+		return;
+
+	TagCache.oldInputs = hashTableNew (1021, hashCstrhash, hashCstreq,
+									   eFree, deleteCachedInput);
+
+	vLine = vStringNew ();
+	if (! readCacheHeader (TagCache.oldMio, vLine))
+		verbose ("ignoring tag cache made with other options: %s\n", TagCache.name);
+	else if (! readCacheRecords (TagCache.oldMio, vLine))
+	{
+		verbose ("ignoring broken tag cache: %s\n", TagCache.name);
+		hashTableClear (TagCache.oldInputs);
+	}
+	else
+		verbose ("%u input files in tag cache: %s\n",
+				 hashTableCountItem (TagCache.oldInputs), TagCache.name);
+	vStringDelete (vLine);
+}
+
+extern void openTagCache (void)
+{
+	vString *name;
+
+	TagCache.optionsFingerprint = getOptionsFingerprint ();
+	TagCache.fingerprint = makeFingerprint ();
+
+	name = vStringNewInit (Option.tagFileName);
+	vStringCatS (name, ".cache");
+	TagCache.name = eStrdup (vStringValue (name));
+	vStringCatS (name, ".tmp");
+	TagCache.tempName = vStringDeleteUnwrap (name);
+
+	loadOldTagCache ();
+
+	TagCache.newMio = mio_new_file (TagCache.tempName, "wb");
+	if (TagCache.newMio == NULL)
+		error (FATAL | PERROR, "cannot open tag cache: %s", TagCache.tempName);
+	mio_printf (TagCache.newMio, "%s%llu\t%s\n", TAG_CACHE_MAGIC,
+				(unsigned long long) time (NULL),
+				vStringValue (TagCache.fingerprint));
+	/* Nothing buffered must be written twice by --jobs. */
+	mio_flush (TagCache.newMio);
+
+	TagCache.current.languages = vStringNew ();
+	TagCache.disabled = false;
+}
+
+extern void closeTagCache (void)
+{
+	if (TagCache.name == NULL)
+		return;
+
+	if (TagCache.oldMio)
+		mio_unref (TagCache.oldMio);
+	if (TagCache.oldInputs)
+		hashTableDelete (TagCache.oldInputs);
+	if (mio_unref (TagCache.newMio) != 0)
+		error (FATAL | PERROR, "cannot close tag cache: %s", TagCache.tempName);
+
+#ifdef WIN32
+	remove (TagCache.name);
+#endif
+	if (rename (TagCache.tempName, TagCache.name) != 0)
+		error (FATAL | PERROR, "cannot replace tag cache: %s", TagCache.name);
+
+	eFree (TagCache.name);
+	eFree (TagCache.tempName);
+	vStringDelete (TagCache.fingerprint);
+	vStringDelete (TagCache.current.languages);
+	TagCache.name = NULL;
+	TagCache.tempName = NULL;
+	TagCache.fingerprint = NULL;
+	TagCache.current.languages = NULL;
+	TagCache.oldMio = NULL;
+	TagCache.oldInputs = NULL;
+	TagCache.newMio = NULL;
+	TagCache.disabled = true;
+}
+
+static bool isTagCacheUsable (const char *const fileName)
+{
+	if (TagCache.disabled)
+		return false;
+
+	/* An option given between input files on the command line may
+	   change the tags of the files following the option. */
+	if (TagCache.optionsFingerprint != getOptionsFingerprint ())
+	{
+		verbose ("disabling tag cache: options are changed\n");
+		TagCache.disabled = true;
+		return false;
+	}
+
+	/* A record cannot hold a file name including a newline. */
+	return strchr (fileName, '\n') == NULL;
+}
+
+static void writeCacheRecord (const char *const fileName,
+							  unsigned long size, time_t mtime,
+							  long files, long lines, long bytes,
+							  unsigned long tags, const char *const languages,
+							  const char *const tagLines, unsigned long length)
+{
+	mio_printf (TagCache.newMio, "%lu %lld %ld %ld %ld %lu %lu %s %s\n",
+				size, (long long) mtime, files, lines, bytes,
+				tags, length, (*languages == '\0')? "-": languages,
+				fileName);
+	if (length > 0
+		&& mio_write (TagCache.newMio, tagLines, 1, length) != length)
+		error (FATAL | PERROR, "cannot write tag cache: %s", TagCache.tempName);
+}
+
+extern bool replayCachedTags (const char *const fileName,
+							  unsigned long size, time_t mtime)
+{
+	cachedInput *c;
+	char *tagLines;
+	const char *lang;
+
+	if (TagCache.oldInputs == NULL || ! isTagCacheUsable (fileName))
+		return false;
+
+	c = hashTableGetItem (TagCache.oldInputs, fileName);
+	if (c == NULL || c->size != size || c->mtime != mtime
+		|| c->mtime >= TagCache.oldTime)
+		return false;
+
+	/* The parsers must be still available. */
+	if (strcmp (c->languages, "-") != 0)
+	{
+		for (lang = c->languages; *lang != '\0'; )
+		{
+			size_t len = strcspn (lang, ",");
+			langType language = getNamedLanguage (lang, len);
+
+			if (language == LANG_IGNORE || ! isLanguageEnabled (language))
+				return false;
+			lang += len;
+			if (*lang == ',')
+				lang++;
+		}
+	}
+
+	tagLines = xMalloc (c->length + 1, char);
+	if (mio_seek (TagCache.oldMio, c->offset, SEEK_SET) != 0
+		|| mio_read (TagCache.oldMio, tagLines, 1, c->length) != c->length)
+	{
+		eFree (tagLines);
+		return false;
+	}
+
+	verbose ("using cached tags of %s\n", fileName);
+	if (strcmp (c->languages, "-") != 0)
+	{
+		for (lang = c->languages; *lang != '\0'; )
+		{
+			size_t len = strcspn (lang, ",");
+			makeParserPseudoTags (getNamedLanguage (lang, len));
+			lang += len;
+			if (*lang == ',')
+				lang++;
+		}
+	}
+	writeCachedTagLines (tagLines, c->length, c->tags);
+	addTotals ((unsigned int) c->files,
+			   (unsigned long) c->lines, (unsigned long) c->bytes);
+
+	writeCacheRecord (fileName, size, mtime, c->files, c->lines, c->bytes,
+					  c->tags,
+					  (strcmp (c->languages, "-") == 0)? "": c->languages,
+					  tagLines, c->length);
+	eFree (tagLines);
+
+	return true;
+}
+
+extern void beginCachingTags (const char *const fileName,
+							  unsigned long size, time_t mtime)
+{
+	struct sCurrentInput *current = &TagCache.current;
+
+	Assert (! current->active);
+	if (! isTagCacheUsable (fileName))
+		return;
+
+	current->active = true;
+	current->fileName = eStrdup (fileName);
+	current->size = size;
+	current->mtime = mtime;
+	current->offset = tagFileOffset ();
+	getTotals (&current->files, &current->lines, &current->bytes);
+	vStringClear (current->languages);
+}
+
+extern void noteLanguageForCachedTags (const langType language)
+{
+	struct sCurrentInput *current = &TagCache.current;
+	const char *name;
+	const char *p;
+	size_t len;
+
+	if (! current->active)
+		return;
+
+	name = getLanguageName (language);
+	len = strlen (name);
+	for (p = vStringValue (current->languages); *p != '\0'; )
+	{
+		size_t n = strcspn (p, ",");
+		if (n == len && strncmp (p, name, len) == 0)
+			return;
+		p += n;
+		if (*p == ',')
+			p++;
+	}
+
+	if (vStringLength (current->languages) > 0)
+		vStringPut (current->languages, ',');
+	vStringCatS (current->languages, name);
+}
+
+extern void endCachingTags (void)
+{
+	struct sCurrentInput *current = &TagCache.current;
+	vString *tagLines;
+	unsigned long tags;
+	long files, lines, bytes;
+
+	if (! current->active)
+		return;
+
+	tagLines = vStringNew ();
+	copyTagLinesSince (current->offset, tagLines, &tags);
+	getTotals (&files, &lines, &bytes);
+
+	writeCacheRecord (current->fileName, current->size, current->mtime,
+					  files - current->files, lines - current->lines,
+					  bytes - current->bytes, tags,
+					  vStringValue (current->languages),
+					  vStringValue (tagLines), vStringLength (tagLines));
+
+	vStringDelete (tagLines);
+	eFree (current->fileName);
+	current->fileName = NULL;
+	current->active = false;
+}
+
+/*
+ *  Parallel jobs (--jobs) support
+ *
+ *  Each worker process writes records to its own temporary file, and
+ *  the parent process appends them to the new cache file.
+ */
+
+/* Must be called in a worker process, just after forking. */
+extern void redirectTagCacheForJob (const char *const recordsName)
+{
+	if (TagCache.name == NULL)
+		return;
+
+	/* Don't close the inherited file pointers; the file offsets
+	   are shared with the parent process. */
+	if (TagCache.oldMio)
+	{
+		TagCache.oldMio = mio_new_file (TagCache.name, "rb");
+		if (TagCache.oldMio == NULL)
+			TagCache.disabled = true;
+	}
+	TagCache.newMio = mio_new_file (recordsName, "wb");
+	if (TagCache.newMio == NULL)
+		error (FATAL | PERROR, "cannot open tag cache for job: %s", recordsName);
+}
+
+extern void closeJobTagCache (void)
+{
+	if (TagCache.newMio == NULL)
+		return;
+
+	if (mio_unref (TagCache.newMio) != 0)
+		error (FATAL | PERROR, "cannot close tag cache for job");
+	TagCache.newMio = NULL;
+}
+
+extern void mergeJobTagCache (const char *const recordsName)
+{
+	MIO *const mio = mio_new_file (recordsName, "rb");
+	char buf [1 << 16];
+	size_t n;
+
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open tag cache of job: %s", recordsName);
+
+	while ((n = mio_read (mio, buf, 1, sizeof (buf))) > 0)
+		if (mio_write (TagCache.newMio, buf, 1, n) != n)
+			error (FATAL | PERROR, "cannot write tag cache: %s", TagCache.tempName);
+	mio_unref (mio);
+}
@@ -0,0 +1,38 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines internal interface to the cache of tags of unchanged input files.
+*/
+#ifndef CTAGS_MAIN_TAGCACHE_PRIVATE_H
+#define CTAGS_MAIN_TAGCACHE_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <time.h>
+
+#include "types.h"
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern void openTagCache (void);
+extern void closeTagCache (void);
+
+extern bool replayCachedTags (const char *const fileName,
+							  unsigned long size, time_t mtime);
+extern void beginCachingTags (const char *const fileName,
+							  unsigned long size, time_t mtime);
+extern void noteLanguageForCachedTags (const langType language);
+extern void endCachingTags (void);
+
+extern void redirectTagCacheForJob (const char *const recordsName);
+extern void closeJobTagCache (void);
+extern void mergeJobTagCache (const char *const recordsName);
+
+#endif  /* CTAGS_MAIN_TAGCACHE_PRIVATE_H */
@@ -0,0 +1,269 @@
+/*
+*   Copyright (c) 2026, Universal Ctags Team
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for writing the index of a tag file
+*   (--index). libreadtags uses the index to find a tag by its name
+*   without searching the tag file.
+*
+*   The index is written to "<tagfile>.idx". All integers are unsigned
+*   and stored in little endian. The file starts with a 40 bytes header:
+*
+*	offset  size
+*	     0     8  magic "!_TAGIDX"
+*	     8     4  format version (2)
+*	    12     4  number of bits of the bucket table (B)
+*	    16     8  size of the tag file
+*	    24     8  last modified time of the tag file, in seconds
+*	    32     4  number of entries (N)
+*	    36     4  nanoseconds of the last modified time (0 if unknown)
+*
+*   The bucket table follows: 2^B + 1 4-byte indexes into the entries.
+*   The entries of bucket i are from the i-th index to the (i+1)-th index
+*   (exclusive). Then N 12-byte entries follow, each holding the 4-byte
+*   hash of a tag name and the 8-byte offset of the tag line in the tag
+*   file. An entry belongs to the bucket specified by the highest B bits
+*   of its hash. The entries are sorted by hash, and then by offset.
+*
+*   The hash is 32-bit FNV-1a of the tag name, the bytes before the first
+*   tab in the tag line, after unescaping the escape sequences that
+*   readtags decodes (\t, \\, \x41, ...).
+*
+*   Keep this in sync with libreadtags/readtags.c.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "debug.h"
+#include "mio.h"
+#include "options.h"
+#include "read.h"
+#include "routines.h"
+#include "tagindex_p.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define TAG_INDEX_MAGIC "!_TAGIDX"
+#define TAG_INDEX_FORMAT 2
+#define TAG_INDEX_HEADER_SIZE 40
+#define TAG_INDEX_ENTRY_SIZE 12
+#define TAG_INDEX_MAX_BITS 24
+
+#if defined(_WIN32)
+# define ST_MTIME_NSEC(st) 0
+#elif defined(__APPLE__)
+# define ST_MTIME_NSEC(st) ((st).st_mtimespec.tv_nsec)
+#else
+# define ST_MTIME_NSEC(st) ((st).st_mtim.tv_nsec)
+#endif
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sTagIndexEntry {
+	uint32_t hash;
+	uint64_t offset;
+} tagIndexEntry;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static int hexValue (const unsigned char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	else if (c >= 'a' && c <= 'f')
+		return 10 + c - 'a';
+	else
+		return 10 + c - 'A';
+}
+
+/* Decode a character at *S in the same way as readTagCharacter() of
+ * libreadtags, and advance *S to the next character. */
+static unsigned char readTagNameCharacter (const char **const s, const char *const end)
+{
+	const unsigned char *p = (const unsigned char *) *s;
+	unsigned char c = *p++;
+
+	if (c == '\\' && (const char *) p < end)
+	{
+		switch (*p)
+		{
+			case 't': c = '\t'; p++; break;
+			case 'r': c = '\r'; p++; break;
+			case 'n': c = '\n'; p++; break;
+			case '\\': c = '\\'; p++; break;
+			case 'a': c = '\a'; p++; break;
+			case 'b': c = '\b'; p++; break;
+			case 'v': c = '\v'; p++; break;
+			case 'f': c = '\f'; p++; break;
+			case 'x':
+				if ((const char *) p + 2 < end
+					&& isxdigit (p [1]) && isxdigit (p [2])
+					&& hexValue (p [1]) < 8)
+				{
+					c = (unsigned char) ((hexValue (p [1]) << 4) | hexValue (p [2]));
+					p += 3;
+				}
+				break;
+		}
+	}
+	*s = (const char *) p;
+	return c;
+}
+
+static uint32_t hashTagName (const char *name, size_t length)
+{
+	uint32_t hash = 2166136261U;
+	const char *const end = name + length;
+
+	while (name < end)
+	{
+		hash ^= readTagNameCharacter (&name, end);
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+static int compareTagIndexEntries (const void *const one, const void *const two)
+{
+	const tagIndexEntry *const e1 = one;
+	const tagIndexEntry *const e2 = two;
+
+	if (e1->hash != e2->hash)
+		return (e1->hash < e2->hash)? -1: 1;
+	if (e1->offset != e2->offset)
+		return (e1->offset < e2->offset)? -1: 1;
+	return 0;
+}
+
+/* About four entries per bucket */
+static unsigned int chooseBucketBits (const size_t count)
+{
+	unsigned int bits = 0;
+
+	while (bits < TAG_INDEX_MAX_BITS && ((size_t) 1 << bits) * 4 < count)
+		bits++;
+	return bits;
+}
+
+static void putU32 (unsigned char *const buf, const uint32_t v)
+{
+	for (int i = 0; i < 4; i++)
+		buf [i] = (unsigned char) (v >> (8 * i));
+}
+
+static void putU64 (unsigned char *const buf, const uint64_t v)
+{
+	for (int i = 0; i < 8; i++)
+		buf [i] = (unsigned char) (v >> (8 * i));
+}
+
+static void writeBytes (MIO *const mio, const unsigned char *const buf, const size_t size,
+						const char *const indexName)
+{
+	if (mio_write (mio, buf, 1, size) != size)
+		error (FATAL | PERROR, "cannot write tag index: %s", indexName);
+}
+
+extern void writeTagIndex (const char *const tagFileName)
+{
+	struct stat st;
+	tagIndexEntry *entries = NULL;
+	size_t count = 0;
+	size_t allocated = 0;
+
+	MIO *const tags = mio_new_file (tagFileName, "rb");
+	if (tags == NULL)
+		error (FATAL | PERROR, "cannot open tag file for indexing: %s", tagFileName);
+
+	vString *const vLine = vStringNew ();
+	long offset = mio_tell (tags);
+	const char *line;
+	while ((line = readLineRaw (vLine, tags)) != NULL)
+	{
+		size_t length = strcspn (line, "\t\r\n");
+
+		if (length > 0)
+		{
+			if (count == allocated)
+			{
+				allocated = allocated? allocated * 2: 1024;
+				entries = xRealloc (entries, allocated, tagIndexEntry);
+			}
+			entries [count].hash = hashTagName (line, length);
+			entries [count].offset = (uint64_t) offset;
+			count++;
+		}
+		offset = mio_tell (tags);
+	}
+	vStringDelete (vLine);
+	mio_unref (tags);
+
+	if (count > UINT32_MAX)
+		error (FATAL, "too many tags to index: %s", tagFileName);
+	if (stat (tagFileName, &st) != 0)
+		error (FATAL | PERROR, "cannot stat tag file for indexing: %s", tagFileName);
+
+	qsort (entries, count, sizeof (*entries), compareTagIndexEntries);
+
+	vString *const indexName = vStringNewInit (tagFileName);
+	vStringCatS (indexName, ".idx");
+	MIO *const mio = mio_new_file (vStringValue (indexName), "wb");
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open tag index: %s", vStringValue (indexName));
+	verbose ("writing %lu entries to %s\n", (unsigned long) count, vStringValue (indexName));
+
+	const unsigned int bits = chooseBucketBits (count);
+	unsigned char buf [TAG_INDEX_HEADER_SIZE];
+
+	memset (buf, 0, sizeof (buf));
+	memcpy (buf, TAG_INDEX_MAGIC, 8);
+	putU32 (buf + 8, TAG_INDEX_FORMAT);
+	putU32 (buf + 12, bits);
+	putU64 (buf + 16, (uint64_t) st.st_size);
+	putU64 (buf + 24, (uint64_t) st.st_mtime);
+	putU32 (buf + 32, (uint32_t) count);
+	putU32 (buf + 36, (uint32_t) ST_MTIME_NSEC (st));
+	writeBytes (mio, buf, TAG_INDEX_HEADER_SIZE, vStringValue (indexName));
+
+	/* The bucket table */
+	size_t e = 0;
+	for (uint64_t bucket = 0; bucket <= ((uint64_t) 1 << bits); bucket++)
+	{
+		while (e < count
+			   && (bits == 0? 0: (entries [e].hash >> (32 - bits))) < bucket)
+			e++;
+		putU32 (buf, (uint32_t) e);
+		writeBytes (mio, buf, 4, vStringValue (indexName));
+	}
+
+	for (e = 0; e < count; e++)
+	{
+		putU32 (buf, entries [e].hash);
+		putU64 (buf + 4, entries [e].offset);
+		writeBytes (mio, buf, TAG_INDEX_ENTRY_SIZE, vStringValue (indexName));
+	}
+
+	if (mio_unref (mio) != 0)
+		error (FATAL | PERROR, "cannot close tag index: %s", vStringValue (indexName));
+
+	vStringDelete (indexName);
+	if (entries)
+		eFree (entries);
+}
@@ -112,6 +112,11 @@ extern const char *outputDefaultFileName (void)
 	return writer->defaultFileName;
 }
 
+extern bool writerIsCtagsFormat (void)
+{
+	return (writer->type == WRITER_U_CTAGS || writer->type == WRITER_E_CTAGS);
+}
+
 extern bool writerCanPrintPtag (void)
 {
 	return (writer->writePtagEntry)? true: false;
@@ -94,6 +94,7 @@ extern bool ptagMakeCtagsOutputMode (ptagDesc *desc, langType language CTAGS_ATT
 extern bool ptagMakeCtagsOutputFilesep (ptagDesc *desc, langType language CTAGS_ATTR_UNUSED, const void *data);
 extern bool ptagMakeCtagsOutputExcmd (ptagDesc *desc, langType language CTAGS_ATTR_UNUSED, const void *data);
 
+extern bool writerIsCtagsFormat (void);
 extern bool writerCanPrintPtag (void);
 extern bool writerDoesTreatFieldAsFixed (int fieldType);
 
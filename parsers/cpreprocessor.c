@@ -200,6 +200,19 @@ static int externalParserBlockNestLevel;
  */
 static bool BraceFormat = false;
 
+/*  Set when a conditional is handled in the way the pass with
+ *  BraceFormat does not handle it. The passes read different code
+ *  after that, so no checkpoint is taken for resuming the next pass.
+ */
+static bool BranchChoiceDiverged = false;
+
+/*  The state taken by cppCheckpoint ()
+ */
+static struct sCppCheckpoint {
+	bool resolveRequired;
+	struct sDirective directive;
+} CppCheckpoint;
+
 void cppPushExternalParserBlock(void)
 {
 	externalParserBlockNestLevel++;
@@ -284,6 +297,7 @@ static void cppInitCommon(langType clientLang,
 		     int macrodefFieldIndex)
 {
 	BraceFormat = state;
+	BranchChoiceDiverged = false;
 
 	CXX_DEBUG_PRINT("cppInit: brace format is %d",BraceFormat);
 
@@ -441,6 +455,31 @@ extern void cppTerminate (void)
 	}
 }
 
+extern bool cppCheckpoint (void)
+{
+	/* The macros found in the symbol table are cached in
+	 * fileMacroTable. The cache cannot be taken back. */
+	if (BraceFormat || BranchChoiceDiverged
+		|| Cpp.ungetDataSize > 0 || Cpp.macroInUse
+		|| Cpp.fileMacroTable
+		|| Cpp.directive.state != DRCTV_NONE)
+		return false;
+
+	CppCheckpoint.resolveRequired = Cpp.resolveRequired;
+	CppCheckpoint.directive = Cpp.directive;
+	CppCheckpoint.directive.name = NULL;
+	return true;
+}
+
+extern void cppResume (void)
+{
+	vString *name = Cpp.directive.name;
+
+	Cpp.resolveRequired = CppCheckpoint.resolveRequired;
+	Cpp.directive = CppCheckpoint.directive;
+	Cpp.directive.name = name;
+}
+
 extern void cppBeginStatement (void)
 {
 	Cpp.resolveRequired = true;
@@ -708,6 +747,8 @@ static bool isIgnoreBranch (void)
 		)
 	{
 		CXX_DEBUG_PRINT("Choosing single branch");
+		if (!ifdef->singleBranch)
+			BranchChoiceDiverged = true;
 		ifdef->singleBranch = true;
 	}
 
@@ -728,9 +769,12 @@ static void chooseBranch (void)
 	if (! BraceFormat)
 	{
 		conditionalInfo *const ifdef = currentConditional ();
+		const bool branchChosen = (bool) (ifdef->singleBranch ||
+										  Cpp.resolveRequired);
 
-		ifdef->branchChosen = (bool) (ifdef->singleBranch ||
-										Cpp.resolveRequired);
+		if (ifdef->branchChosen != branchChosen)
+			BranchChoiceDiverged = true;
+		ifdef->branchChosen = branchChosen;
 	}
 }
 
@@ -760,6 +804,8 @@ static bool pushConditional (const bool firstBranchChosen)
 		ifdef->ignoring = (bool) (ignoreAllBranches || (
 				! firstBranchChosen  &&  ! BraceFormat  &&
 				(ifdef->singleBranch || !doesExaminCodeWithInIf0Branch)));
+		if (ifdef->ignoring && !ignoreAllBranches)
+			BranchChoiceDiverged = true;
 		ifdef->enterExternalParserBlockNestLevel = externalParserBlockNestLevel;
 		ifdef->asmArea.line = 0;
 		ignoreBranch = ifdef->ignoring;
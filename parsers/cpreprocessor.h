@@ -100,6 +100,15 @@ extern void cppUngetString(const char * string,int len);
 extern int cppGetc (void);
 extern const vString * cppGetLastCharOrStringContents (void);
 
+/* Take the state of the preprocessor for resuming the next pass of the
+ * client parser from the current position with cppResume (), after
+ * cppInit () for the pass. cppCheckpoint () returns false if the state
+ * cannot be taken: in the middle of a macro expansion, or after a branch
+ * of a conditional is chosen in the way the next pass will not choose.
+ * The contents of the last STRING_SYMBOL or CHAR_SYMBOL are not taken. */
+extern bool cppCheckpoint (void);
+extern void cppResume (void);
+
 /*
  * Replacement for vStringPut that can handle c > 0xff
  */
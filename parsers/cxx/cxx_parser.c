@@ -63,6 +63,58 @@ void cxxParserNewStatement(void)
 	cppEndStatement();
 }
 
+//
+// Called at each iteration of the toplevel block parsing loop.
+//
+// In the first pass a checkpoint is taken when the loop is between two
+// statements: the token chain is empty and nothing is pending in the
+// preprocessor. The second pass is run only if the first pass fails and,
+// until the preprocessor chooses a conditional branch in the way the
+// second pass would not, both passes see the same input. The tags made
+// before the checkpoint are kept and the second pass resumes from the
+// checkpoint instead of starting from the beginning of the file.
+//
+void cxxParserCheckpoint(void)
+{
+	if(g_cxx.bResumeFromCheckpoint)
+	{
+		CXX_DEBUG_PRINT("Resuming from the checkpoint");
+		g_cxx.bResumeFromCheckpoint = false;
+		cppResume();
+		g_cxx.iChar = g_cxx.iCheckpointChar;
+		g_cxx.bConfirmedCPPLanguage = g_cxx.bCheckpointConfirmedCPPLanguage;
+		return;
+	}
+
+	if(!g_cxx.bTakeCheckpoints)
+		return;
+
+	if(
+			(g_cxx.pTokenChain->iCount > 0) ||
+			g_cxx.pUngetToken ||
+			g_cxx.pTemplateTokenChain ||
+			(g_cxx.uKeywordState != 0) ||
+			(g_cxx.iChar == STRING_SYMBOL) ||
+			(g_cxx.iChar == CHAR_SYMBOL) ||
+			!cxxScopeIsGlobal()
+		)
+		return;
+
+	if(!cppCheckpoint())
+		return;
+
+	if(!markRescanCheckpoint())
+	{
+		// The state taken by cppCheckpoint() is not the one at the
+		// checkpoint marked before. Make no further checkpoint.
+		g_cxx.bTakeCheckpoints = false;
+		return;
+	}
+
+	g_cxx.iCheckpointChar = g_cxx.iChar;
+	g_cxx.bCheckpointConfirmedCPPLanguage = g_cxx.bConfirmedCPPLanguage;
+}
+
 //
 // Parse a subchain of input delimited by matching pairs selected from
 // [],(),{} and <>.
@@ -1925,6 +1977,9 @@ static rescanReason cxxParserMain(const unsigned int passCount)
 
 	g_cxx.iNestingLevels = 0;
 
+	g_cxx.bTakeCheckpoints = (passCount == 1);
+	g_cxx.bResumeFromCheckpoint = (passCount > 1) && resumeRescanCheckpoint();
+
 	bool bRet = cxxParserParseBlock(false);
 
 	cppTerminate ();
@@ -271,6 +271,9 @@ static bool cxxParserParseBlockInternal(bool bExpectClosingBracket)
 
 	for(;;)
 	{
+		if(!bExpectClosingBracket)
+			cxxParserCheckpoint();
+
 		if(!cxxParserParseNextToken())
 		{
 found_eof:
@@ -221,6 +221,7 @@ bool cxxParserParseNamespace(void);
 
 // cxx_parser.c
 void cxxParserNewStatement(void);
+void cxxParserCheckpoint(void);
 bool cxxParserSkipToSemicolonOrEOF(void);
 bool cxxParserParseToEndOfQualifedName(void);
 bool cxxParserParseEnum(void);
@@ -372,6 +373,18 @@ typedef struct _CXXParserState
 	// This usually happens only with erroneous macro usage or broken input.
 	int iNestingLevels;
 
+	// The first pass takes a checkpoint at each toplevel statement boundary
+	// while this is true. When the pass fails the second pass resumes
+	// from the last checkpoint. See cxxParserCheckpoint().
+	bool bTakeCheckpoints;
+
+	// True at the beginning of the second pass resuming from the checkpoint.
+	bool bResumeFromCheckpoint;
+
+	// The state taken at the last checkpoint
+	int iCheckpointChar;
+	bool bCheckpointConfirmedCPPLanguage;
+
 } CXXParserState;
 
 
@@ -12,33 +12,67 @@
 #include "routines.h"
 #include "vstring.h"
 #include "read.h"
-#include "objpool.h"
 
 #include "cxx_token_chain.h"
 #include "cxx_debug.h"
 #include "cxx_keyword.h"
 #include "cxx_tag.h"
 
+// Tokens are carved out of slabs of CXX_TOKEN_SLAB_SIZE tokens and
+// recycled through a free list. Unlike the objPool used before, the free
+// list is not capped: a file that keeps many tokens alive (a long
+// initializer list, a large class body) doesn't make us free and
+// reallocate tokens and their strings over and over. When a new file is
+// started and no token is alive the slabs are released if there are more
+// than CXX_TOKEN_POOL_MAXIMUM_SIZE tokens in them.
+#define CXX_TOKEN_SLAB_SIZE 256
 #define CXX_TOKEN_POOL_MAXIMUM_SIZE 8192
 
-static objPool * g_pTokenPool = NULL;
+typedef struct _CXXTokenSlab
+{
+	struct _CXXTokenSlab * pNext;
+	CXXToken aTokens[CXX_TOKEN_SLAB_SIZE];
+} CXXTokenSlab;
 
-void cxxTokenForceDestroy(CXXToken * t);
+static CXXTokenSlab * g_pTokenSlabs = NULL;
+static unsigned int g_uTokenSlabCount = 0;
+static CXXToken * g_pFreeTokens = NULL;
+static unsigned int g_uLiveTokenCount = 0;
 
-static CXXToken *createToken(void *createArg CTAGS_ATTR_UNUSED)
+static void addTokenSlab(void)
 {
-	CXXToken *t = xMalloc(1, CXXToken);
-	// we almost always want a string, and since this token
-	// is being reused..well.. we always want it
-	t->pszWord = vStringNew();
-	t->iCorkIndex = CORK_NIL;
-	return t;
+	CXXTokenSlab * pSlab = xMalloc(1,CXXTokenSlab);
+
+	pSlab->pNext = g_pTokenSlabs;
+	g_pTokenSlabs = pSlab;
+	g_uTokenSlabCount++;
+
+	// The strings are allocated when the tokens are taken the first time
+	for(int i = CXX_TOKEN_SLAB_SIZE - 1;i >= 0;i--)
+	{
+		CXXToken * t = pSlab->aTokens + i;
+		t->pszWord = NULL;
+		t->pNext = g_pFreeTokens;
+		g_pFreeTokens = t;
+	}
 }
 
-static void deleteToken(CXXToken *token)
+static void releaseTokenSlabs(void)
 {
-	vStringDelete(token->pszWord);
-	eFree(token);
+	while(g_pTokenSlabs)
+	{
+		CXXTokenSlab * pSlab = g_pTokenSlabs;
+		g_pTokenSlabs = pSlab->pNext;
+
+		for(int i = 0;i < CXX_TOKEN_SLAB_SIZE;i++)
+		{
+			if(pSlab->aTokens[i].pszWord)
+				vStringDelete(pSlab->aTokens[i].pszWord);
+		}
+		eFree(pSlab);
+	}
+	g_uTokenSlabCount = 0;
+	g_pFreeTokens = NULL;
 }
 
 static void clearToken(CXXToken *t)
@@ -60,42 +94,43 @@ static void clearToken(CXXToken *t)
 
 void cxxTokenAPIInit(void)
 {
-	g_pTokenPool = objPoolNew(CXX_TOKEN_POOL_MAXIMUM_SIZE,
-		(objPoolCreateFunc)createToken, (objPoolDeleteFunc)deleteToken,
-		(objPoolClearFunc)clearToken,
-		NULL);
+	/* Stub */
 }
 
 void cxxTokenAPINewFile(void)
 {
-	/* Stub */
+	if(
+			(g_uLiveTokenCount == 0) &&
+			(g_uTokenSlabCount * CXX_TOKEN_SLAB_SIZE > CXX_TOKEN_POOL_MAXIMUM_SIZE)
+		)
+		releaseTokenSlabs();
 }
 
 void cxxTokenAPIDone(void)
 {
-	objPoolDelete (g_pTokenPool);
+	releaseTokenSlabs();
+	g_uLiveTokenCount = 0;
 }
 
 CXXToken * cxxTokenCreate(void)
 {
-	return objPoolGet (g_pTokenPool);
-}
+	if(!g_pFreeTokens)
+		addTokenSlab();
 
-void cxxTokenDestroy(CXXToken * t)
-{
-	if(!t)
-		return;
+	CXXToken * t = g_pFreeTokens;
+	g_pFreeTokens = t->pNext;
+	g_uLiveTokenCount++;
 
-	if(t->pChain)
-	{
-		cxxTokenChainDestroy(t->pChain);
-		t->pChain = NULL;
-	}
+	// we almost always want a string, and since this token
+	// is being reused..well.. we always want it
+	if(!t->pszWord)
+		t->pszWord = vStringNew();
 
-	objPoolPut (g_pTokenPool, t);
+	clearToken(t);
+	return t;
 }
 
-void cxxTokenForceDestroy(CXXToken * t)
+void cxxTokenDestroy(CXXToken * t)
 {
 	if(!t)
 		return;
@@ -106,11 +141,9 @@ void cxxTokenForceDestroy(CXXToken * t)
 		t->pChain = NULL;
 	}
 
-	CXX_DEBUG_ASSERT(t->pszWord,"There should be a word here");
-
-	vStringDelete(t->pszWord);
-
-	eFree(t);
+	t->pNext = g_pFreeTokens;
+	g_pFreeTokens = t;
+	g_uLiveTokenCount--;
 }
 
 CXXToken * cxxTokenCopy(CXXToken * pToken)
@@ -1027,7 +1027,7 @@ static bool parseClassName (tokenInfo *const token)
 
 		if (klass)
 		{
-			eFree ((void *)klass->name);
+			freeTagEntryString (&klass->name);
 			klass->name = name;
 			name = NULL;
 			unmarkTagExtraBit (klass, XTAG_ANONYMOUS);
@@ -1050,8 +1050,7 @@ static bool parseClassName (tokenInfo *const token)
 										  XTAG_UNKNOWN);
 				if (klass)
 				{
-					if (klass->extensionFields.inheritance)
-						eFree ((void *)klass->extensionFields.inheritance);
+					freeTagEntryString (&klass->extensionFields.inheritance);
 					klass->extensionFields.inheritance = vStringStrdup (token->string);
 				}
 				else
@@ -1088,8 +1087,7 @@ static bool parseExtends (tokenInfo *const token)
 				tagEntryInfo *klass = getEntryInCorkQueue (nl->corkIndex);
 				if (klass)
 				{
-					if (klass->extensionFields.inheritance)
-						eFree ((void *)klass->extensionFields.inheritance);
+					freeTagEntryString (&klass->extensionFields.inheritance);
 					klass->extensionFields.inheritance = vStringStrdup (token->string);
 				}
 			}
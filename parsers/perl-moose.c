@@ -354,8 +354,7 @@ static bool findExtendsClass (const char *line,
 	if (moose->notContinuousExtendsLines == true
 		&& vStringLength (str) > 0)
 	{
-		if (e->extensionFields.inheritance)
-			eFree ((void *)e->extensionFields.inheritance);
+		freeTagEntryString (&e->extensionFields.inheritance);
 		e->extensionFields.inheritance = vStringStrdup (str);
 	}
 
@@ -383,8 +382,7 @@ static bool findExtendsClassContinuation (const char *line,
 	if (moose->notContinuousExtendsLines == true
 		&& vStringLength (str) > 0)
 	{
-		if (e->extensionFields.inheritance)
-			eFree ((void *)e->extensionFields.inheritance);
+		freeTagEntryString (&e->extensionFields.inheritance);
 		e->extensionFields.inheritance = vStringStrdup (str);
 	}
 
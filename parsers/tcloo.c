@@ -61,10 +61,8 @@ static void parseSuperclass (tokenInfo *token, int this_class)
 
 		if (e)
 		{
-			if (e->extensionFields.inheritance)
-			{   /* superclass is used twice in a class. */
-				eFree ((void *)e->extensionFields.inheritance);
-			}
+			/* superclass is used twice in a class. */
+			freeTagEntryString (&e->extensionFields.inheritance);
 			e->extensionFields.inheritance = eStrdup(tokenString(token));
 		}
 	}
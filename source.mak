@@ -100,6 +100,7 @@ MAIN_PUBLIC_HEADS =		\
 LIB_PRIVATE_HEADS =		\
 	$(UTIL_PRIVATE_HEADS)	\
 	\
+	main/arena_p.h		\
 	main/args_p.h		\
 	main/colprint_p.h	\
 	main/dependency_p.h	\
@@ -119,6 +120,7 @@ LIB_PRIVATE_HEADS =		\
 	main/param_p.h		\
 	main/parse_p.h		\
 	main/parsers_p.h	\
+	main/pathmatch_p.h	\
 	main/portable-dirent_p.h\
 	main/promise_p.h	\
 	main/ptag_p.h		\
@@ -127,6 +129,8 @@ LIB_PRIVATE_HEADS =		\
 	main/sort_p.h		\
 	main/stats_p.h		\
 	main/subparser_p.h	\
+	main/tagcache_p.h	\
+	main/tagindex_p.h	\
 	main/trashbox_p.h	\
 	main/utf8_str.h		\
 	main/writer_p.h		\
@@ -147,6 +151,7 @@ LIB_HEADS =			\
 LIB_SRCS =			\
 	$(UTIL_SRCS)			\
 	\
+	main/arena.c			\
 	main/args.c			\
 	main/colprint.c			\
 	main/dependency.c		\
@@ -160,6 +165,7 @@ LIB_SRCS =			\
 	main/kind.c			\
 	main/lregex.c			\
 	main/lregex-default.c		\
+	main/lregex-prefilter.c		\
 	main/lxpath.c			\
 	main/main.c			\
 	main/mbcs.c			\
@@ -169,6 +175,7 @@ LIB_SRCS =			\
 	main/options.c			\
 	main/param.c			\
 	main/parse.c			\
+	main/pathmatch.c		\
 	main/portable-scandir.c		\
 	main/promise.c			\
 	main/ptag.c			\
@@ -180,6 +187,8 @@ LIB_SRCS =			\
 	main/sort.c			\
 	main/stats.c			\
 	main/strlist.c			\
+	main/tagcache.c			\
+	main/tagindex.c			\
 	main/trace.c			\
 	main/tokeninfo.c		\
 	main/unwindi.c			\